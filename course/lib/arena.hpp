@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+
+namespace mpc {
+
+// Memory resources working on top of a caller-provided buffer: neither of
+// them ever calls the global operator new, and running out of the buffer
+// results in std::bad_alloc.
+
+// Bumps a pointer through the buffer. Deallocation is a no-op, all the
+// memory comes back at once on release().
+class monotonic_arena {
+public:
+  explicit monotonic_arena(std::span<std::byte> buffer) noexcept
+    : buffer_(buffer) {
+  }
+
+  monotonic_arena(const monotonic_arena&) = delete;
+  monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+  void* allocate(std::size_t bytes, std::size_t alignment) {
+    void* current = buffer_.data() + used_;
+    std::size_t space = buffer_.size() - used_;
+    if (std::align(alignment, bytes, current, space) == nullptr) {
+      throw std::bad_alloc{};
+    }
+    used_ = static_cast<std::byte*>(current) - buffer_.data() + bytes;
+    return current;
+  }
+
+  void deallocate(void*, std::size_t, std::size_t) noexcept {
+  }
+
+  void release() noexcept {
+    used_ = 0;
+  }
+
+  std::size_t used() const noexcept {
+    return used_;
+  }
+
+private:
+  std::span<std::byte> buffer_;
+  std::size_t used_ = 0;
+};
+
+// Splits the buffer into equal blocks and recycles them through an
+// intrusive free list, so allocations of similar size cost a couple of
+// loads and stores and freed memory is reused right away.
+class block_pool {
+public:
+  block_pool(std::span<std::byte> buffer, std::size_t block_size,
+             std::size_t alignment = alignof(std::max_align_t)) noexcept
+    : alignment_(std::max(alignment, alignof(Node))) {
+    block_size_ = (std::max(block_size, sizeof(Node)) + alignment_ - 1) / alignment_ * alignment_;
+
+    void* current = buffer.data();
+    std::size_t space = buffer.size();
+    if (std::align(alignment_, block_size_, current, space) == nullptr) {
+      return;
+    }
+    auto* first = static_cast<std::byte*>(current);
+    for (std::size_t i = space / block_size_; i > 0; --i) {
+      push(first + (i - 1) * block_size_);
+    }
+  }
+
+  block_pool(const block_pool&) = delete;
+  block_pool& operator=(const block_pool&) = delete;
+
+  void* allocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes > block_size_ || alignment > alignment_ || free_ == nullptr) {
+      throw std::bad_alloc{};
+    }
+    Node* node = free_;
+    free_ = node->next;
+    --available_;
+    return node;
+  }
+
+  void deallocate(void* p, std::size_t, std::size_t) noexcept {
+    push(p);
+  }
+
+  std::size_t block_size() const noexcept {
+    return block_size_;
+  }
+
+  std::size_t available() const noexcept {
+    return available_;
+  }
+
+private:
+  struct Node {
+    Node* next;
+  };
+
+  void push(void* p) noexcept {
+    free_ = ::new (p) Node{free_};
+    ++available_;
+  }
+
+  std::size_t alignment_;
+  std::size_t block_size_;
+  Node* free_ = nullptr;
+  std::size_t available_ = 0;
+};
+
+// Allocator over a memory resource. Unlike std::pmr::polymorphic_allocator
+// it propagates on copy, move and swap, so copies of containers and boxes
+// keep allocating from the same resource.
+template <class T, class Resource>
+class resource_allocator {
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit resource_allocator(Resource& resource) noexcept
+    : resource_(&resource) {
+  }
+
+  template <class U>
+  resource_allocator(const resource_allocator<U, Resource>& other) noexcept
+    : resource_(other.resource()) {
+  }
+
+  // Byte allocators are used to store objects of unknown types (that's
+  // what Spy does), so the alignment is never weaker than operator new's.
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), kAlignment));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    resource_->deallocate(p, n * sizeof(T), kAlignment);
+  }
+
+  Resource* resource() const noexcept {
+    return resource_;
+  }
+
+  template <class U>
+  friend bool operator==(const resource_allocator& lhs, const resource_allocator<U, Resource>& rhs) noexcept {
+    return lhs.resource() == rhs.resource();
+  }
+
+private:
+  static constexpr std::size_t kAlignment = std::max(alignof(T), std::size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__});
+
+  Resource* resource_;
+};
+
+template <class T>
+using arena_allocator = resource_allocator<T, monotonic_arena>;
+
+template <class T>
+using pool_allocator = resource_allocator<T, block_pool>;
+
+} // namespace mpc
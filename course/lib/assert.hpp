@@ -1,5 +1,14 @@
 #pragma once
 
+// MPC_CHECK_LEVEL selects which sanity checks are compiled in:
+//   2 -- all of them (default, tests rely on it);
+//   1 -- per-element checks (MPC_VERIFY_HOT) are dropped, while range
+//        operations are still validated, once per call;
+//   0 -- no checks at all.
+#ifndef MPC_CHECK_LEVEL
+#define MPC_CHECK_LEVEL 2
+#endif
+
 namespace mpc {
 
 namespace detail {
@@ -9,6 +18,15 @@ struct AssertException
 
 } // namespace detail
 
+// Swallows the condition without evaluating it, so that disabled checks
+// still have to compile.
+#define MPC_VERIFY_DISABLED(condition) \
+do { \
+  (void)sizeof(!(condition)); \
+} while (false)
+
+#if MPC_CHECK_LEVEL >= 1
+
 #define MPC_VERIFY(condition) \
 do { \
   [[unlikely]] if (!(condition)) { \
@@ -24,4 +42,20 @@ do { \
   } \
 } while (false)
 
+#else
+
+#define MPC_VERIFY(condition) MPC_VERIFY_DISABLED(condition)
+#define MPC_VERIFYF(condition, message) MPC_VERIFY_DISABLED(condition)
+
+#endif
+
+// For checks that run once per element (operator[], iterator
+// dereference and so on). A throwing branch inside an inner loop
+// prevents vectorization, so such checks are the first to go.
+#if MPC_CHECK_LEVEL >= 2
+#define MPC_VERIFY_HOT(condition) MPC_VERIFY(condition)
+#else
+#define MPC_VERIFY_HOT(condition) MPC_VERIFY_DISABLED(condition)
+#endif
+
 } // namespace mpc
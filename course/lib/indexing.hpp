@@ -0,0 +1,192 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mpc {
+
+// Indexed access into type packs and lazy type sequences that does not
+// recurse once per element.
+//
+// A pack is any Pack<Ts...> (TTuple, std::tuple, types below, ...).
+// type_at_t and index_of_v on it are a constant number of nested
+// instantiations whatever the length of the pack.
+//
+// A sequence is anything with Head and Tail members, as in the type_lists
+// task. Getting to element I still has to instantiate I Tails of the
+// sequence itself, but chunked<TL, N> walks them N at a time, so the
+// nesting depth is about I / N + N instead of I and the default
+// -ftemplate-depth goes a long way.
+
+template <class... Ts>
+struct types {};
+
+namespace detail {
+
+template <class Pack>
+struct pack_traits {
+  static constexpr bool is_pack = false;
+};
+
+template <template <class...> class Pack, class... Ts>
+struct pack_traits<Pack<Ts...>> {
+  static constexpr bool is_pack = true;
+  static constexpr std::size_t size = sizeof...(Ts);
+};
+
+template <std::size_t I, class T>
+struct indexed {
+  using type = T;
+};
+
+template <class Indices, class... Ts>
+struct indexer;
+
+template <std::size_t... Is, class... Ts>
+struct indexer<std::index_sequence<Is...>, Ts...> : indexed<Is, Ts>... {
+};
+
+// Overload resolution picks the only base with the right index
+template <std::size_t I, class T>
+indexed<I, T> select(const indexed<I, T>&);
+
+template <std::size_t I, class Pack>
+struct pack_at;
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define MPC_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+template <std::size_t I, template <class...> class Pack, class... Ts>
+struct pack_at<I, Pack<Ts...>> {
+#ifdef MPC_HAS_TYPE_PACK_ELEMENT
+  using type = __type_pack_element<I, Ts...>;
+#else
+  using type = typename decltype(select<I>(std::declval<indexer<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+#endif
+};
+
+#undef MPC_HAS_TYPE_PACK_ELEMENT
+
+template <class T, class Pack>
+struct pack_index_of;
+
+template <class T, template <class...> class Pack, class... Ts>
+struct pack_index_of<T, Pack<Ts...>> {
+  static constexpr std::size_t value = [] {
+    // The leading false keeps the array non-empty
+    constexpr bool matches[] = {false, std::is_same_v<T, Ts>...};
+    std::size_t i = 0;
+    while (i < sizeof...(Ts) && !matches[i + 1]) {
+      ++i;
+    }
+    return i;
+  }();
+};
+
+} // namespace detail
+
+template <class Pack>
+concept type_pack = detail::pack_traits<Pack>::is_pack;
+
+template <type_pack Pack>
+inline constexpr std::size_t pack_size_v = detail::pack_traits<Pack>::size;
+
+template <std::size_t I, type_pack Pack>
+  requires (I < pack_size_v<Pack>)
+using type_at_t = typename detail::pack_at<I, Pack>::type;
+
+// Index of the first T in Pack, pack_size_v<Pack> if there is none
+template <class T, type_pack Pack>
+inline constexpr std::size_t index_of_v = detail::pack_index_of<T, Pack>::value;
+
+template <class T, class Pack>
+concept pack_member = type_pack<Pack> && index_of_v<T, Pack> < pack_size_v<Pack>;
+
+template <class TL>
+concept type_sequence =
+  requires {
+    typename TL::Head;
+    typename TL::Tail;
+  };
+
+namespace detail {
+
+// Stops at the end of a finite sequence instead of failing
+template <class TL>
+struct tail {
+  using type = TL;
+};
+
+template <type_sequence TL>
+struct tail<TL> {
+  using type = typename TL::Tail;
+};
+
+// Nesting depth I, every prefix is shared between queries
+template <std::size_t I, class TL>
+struct nth {
+  using type = typename tail<typename nth<I - 1, TL>::type>::type;
+};
+
+template <class TL>
+struct nth<0, TL> {
+  using type = TL;
+};
+
+template <std::size_t I, class TL>
+using nth_t = typename nth<I, TL>::type;
+
+template <class TL, std::size_t N>
+struct chunk_length {
+  static constexpr std::size_t value = [] {
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+      return (std::size_t{0} + ... + std::size_t{type_sequence<nth_t<Is, TL>>});
+    }(std::make_index_sequence<N>{});
+  }();
+};
+
+template <class TL, class Indices>
+struct chunk_of;
+
+template <class TL, std::size_t... Is>
+struct chunk_of<TL, std::index_sequence<Is...>> {
+  using type = types<typename nth_t<Is, TL>::Head...>;
+};
+
+} // namespace detail
+
+// Sequence of types<...> holding N consecutive elements of TL each, the
+// last one may be shorter. Empty when TL is.
+template <class TL, std::size_t N = 64>
+struct chunked {
+  static_assert(N > 0);
+
+  using sequence = TL;
+};
+
+template <type_sequence TL, std::size_t N>
+struct chunked<TL, N> {
+  static_assert(N > 0);
+
+  using sequence = TL;
+
+  using Head =
+    typename detail::chunk_of<TL, std::make_index_sequence<detail::chunk_length<TL, N>::value>>::type;
+  using Tail = chunked<detail::nth_t<N, TL>, N>;
+};
+
+// TL without its first I elements, or whatever is left at its end
+template <std::size_t I, class TL, std::size_t N = 64>
+using sequence_drop_t =
+  detail::nth_t<I % N, typename detail::nth_t<I / N, chunked<TL, N>>::sequence>;
+
+template <std::size_t I, class TL, std::size_t N = 64>
+  requires type_sequence<sequence_drop_t<I, TL, N>>
+using sequence_at_t = typename sequence_drop_t<I, TL, N>::Head;
+
+} // namespace mpc
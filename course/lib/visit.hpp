@@ -0,0 +1,69 @@
+#pragma once
+
+#include "assert.hpp"
+#include "indexing.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace mpc {
+
+// visit_at<Pack>(i, f) calls f.template operator()<T>() for the i-th type
+// T of Pack through a constexpr table of function pointers, so dispatching
+// a runtime tag is one bounds check and one indirect call however long the
+// pack is. For a lazy list, turn its finite prefix into a pack first
+// (ToTuple<Take<N, TL>> in the type_lists task).
+//
+// Every alternative has to return the same type.
+
+template <class F, class T>
+concept visitor_for =
+  requires (F&& f) {
+    std::forward<F>(f).template operator()<T>();
+  };
+
+namespace detail {
+
+template <class F, class T>
+using visit_result_t = decltype(std::declval<F>().template operator()<T>());
+
+template <class F, class Pack>
+struct visit_table;
+
+template <class F, template <class...> class Pack, class T, class... Ts>
+  requires (std::same_as<visit_result_t<F, T>, visit_result_t<F, Ts>> && ...)
+struct visit_table<F, Pack<T, Ts...>> {
+  using result = visit_result_t<F, T>;
+  using entry = result (*)(F&&);
+
+  template <class U>
+  static constexpr result invoke(F&& f) {
+    return std::forward<F>(f).template operator()<U>();
+  }
+
+  static constexpr std::array<entry, 1 + sizeof...(Ts)> value = {&invoke<T>, &invoke<Ts>...};
+};
+
+template <class F, class Pack>
+struct visitable : std::false_type {
+};
+
+template <class F, template <class...> class Pack, class T, class... Ts>
+  requires visitor_for<F, T> && (visitor_for<F, Ts> && ...)
+struct visitable<F, Pack<T, Ts...>>
+  : std::bool_constant<(std::same_as<visit_result_t<F, T>, visit_result_t<F, Ts>> && ...)> {
+};
+
+} // namespace detail
+
+template <type_pack Pack, class F>
+  requires (pack_size_v<Pack> > 0) && detail::visitable<F, Pack>::value
+constexpr decltype(auto) visit_at(std::size_t index, F&& f) {
+  using table = detail::visit_table<F, Pack>;
+  MPC_VERIFY(index < table::value.size());
+  return table::value[index](std::forward<F>(f));
+}
+
+} // namespace mpc
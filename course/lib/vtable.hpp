@@ -0,0 +1,254 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mpc {
+
+// Building blocks for type-erased boxes (Spy, Function, any_object and
+// friends). An entry describes one erased operation:
+//
+//   struct my_entry {
+//     using Signature = R(Args...);
+//
+//     template <class T>
+//     static R invoke(Args...);
+//   };
+//
+// vtable<Entries...> holds one function pointer per entry and a tag of the
+// erased type for holds<T>(). Where the table lives is up to a policy:
+// inline_vtable keeps all the pointers inside the box, static_vtable keeps
+// a single pointer to a table in static storage shared by all boxes
+// holding the same T (one more indirection per call, but the box shrinks
+// to a pointer whatever the number of entries).
+
+template <class... Entries>
+struct entry_list {};
+
+namespace detail {
+
+template <class Entry>
+struct vtable_slot {
+  typename Entry::Signature* fptr = nullptr;
+};
+
+template <class Entry, class... Entries>
+concept one_of = (std::same_as<Entry, Entries> || ...);
+
+// Identifies T in holds(). Function addresses cannot do that: identical
+// code folding may give invoke<T> and invoke<U> the same one. The tag is
+// mutable, so the linker has no reason to merge two of them either.
+template <class T>
+inline char type_tag = 0;
+
+template <class... Lists>
+struct concat;
+
+template <class... Ls>
+struct concat<entry_list<Ls...>> {
+  using type = entry_list<Ls...>;
+};
+
+template <class... Ls, class... Rs, class... Lists>
+struct concat<entry_list<Ls...>, entry_list<Rs...>, Lists...>
+  : concat<entry_list<Ls..., Rs...>, Lists...> {
+};
+
+template <class Policy, class List>
+struct apply_policy;
+
+template <class Policy, class... Entries>
+struct apply_policy<Policy, entry_list<Entries...>> {
+  using type = typename Policy::template storage<Entries...>;
+};
+
+} // namespace detail
+
+template <class... Entries>
+  requires (sizeof...(Entries) > 0)
+struct vtable : detail::vtable_slot<Entries>... {
+  template <class T>
+  static constexpr vtable make() {
+    vtable result;
+    ((static_cast<detail::vtable_slot<Entries>&>(result).fptr = &Entries::template invoke<T>), ...);
+    result.type = &detail::type_tag<T>;
+    return result;
+  }
+
+  template <class Entry>
+    requires detail::one_of<Entry, Entries...>
+  constexpr auto get() const {
+    return static_cast<const detail::vtable_slot<Entry>&>(*this).fptr;
+  }
+
+  constexpr bool empty() const {
+    return ((get<Entries>() == nullptr) && ...);
+  }
+
+  // The tag of T for make<T>()
+  const void* type = nullptr;
+};
+
+// The one and only table for T, so its address identifies T
+template <class T, class... Entries>
+inline constexpr vtable<Entries...> vtable_for = vtable<Entries...>::template make<T>();
+
+template <class... Entries>
+class inline_vtable {
+public:
+  constexpr inline_vtable() = default;
+
+  template <class T>
+  static constexpr inline_vtable make() {
+    inline_vtable result;
+    result.table_ = vtable<Entries...>::template make<T>();
+    return result;
+  }
+
+  // Copies its entries out of any table (storage) having at least these,
+  // e.g. to view a box through a narrower interface. A static_vtable
+  // cannot do that: there is no table for T with just these entries.
+  template <class Source>
+  static constexpr inline_vtable subset_of(const Source& source) {
+    inline_vtable result;
+    ((static_cast<detail::vtable_slot<Entries>&>(result.table_).fptr = source.template get<Entries>()), ...);
+    result.table_.type = source.type();
+    return result;
+  }
+
+  template <class Entry>
+  constexpr auto get() const {
+    return table_.template get<Entry>();
+  }
+
+  template <class Entry, class... Args>
+  constexpr decltype(auto) call(Args&&... args) const {
+    return get<Entry>()(std::forward<Args>(args)...);
+  }
+
+  template <class T>
+  constexpr bool holds() const {
+    return table_.type == &detail::type_tag<T>;
+  }
+
+  // The tag of the stored type, nullptr when empty
+  constexpr const void* type() const {
+    return table_.type;
+  }
+
+  constexpr bool empty() const {
+    return table_.empty();
+  }
+
+private:
+  vtable<Entries...> table_;
+};
+
+template <class... Entries>
+class static_vtable {
+public:
+  constexpr static_vtable() = default;
+
+  template <class T>
+  static constexpr static_vtable make() {
+    static_vtable result;
+    result.table_ = &vtable_for<T, Entries...>;
+    return result;
+  }
+
+  template <class Entry>
+  constexpr auto get() const {
+    return table_->template get<Entry>();
+  }
+
+  template <class Entry, class... Args>
+  constexpr decltype(auto) call(Args&&... args) const {
+    return get<Entry>()(std::forward<Args>(args)...);
+  }
+
+  template <class T>
+  constexpr bool holds() const {
+    return table_ == &vtable_for<T, Entries...>;
+  }
+
+  constexpr const void* type() const {
+    return table_ == nullptr ? nullptr : table_->type;
+  }
+
+  constexpr bool empty() const {
+    return table_ == nullptr;
+  }
+
+private:
+  const vtable<Entries...>* table_ = nullptr;
+};
+
+struct inline_vtable_policy {
+  template <class... Entries>
+  using storage = inline_vtable<Entries...>;
+};
+
+struct static_vtable_policy {
+  template <class... Entries>
+  using storage = static_vtable<Entries...>;
+};
+
+template <class Policy, class... Lists>
+using vtable_storage_t =
+  typename detail::apply_policy<Policy, typename detail::concat<Lists...>::type>::type;
+
+// Lifetime entries, all of them work on raw storage. Boxes keeping a
+// pointer to a heap-allocated object move it without relocate_entry.
+
+// Destroys the object at self
+struct destroy_entry {
+  using Signature = void(void* self) noexcept;
+
+  template <class T>
+  static void invoke(void* self) noexcept {
+    std::destroy_at(static_cast<T*>(self));
+  }
+};
+
+// Copy-constructs an object at to from the one at from
+struct copy_entry {
+  using Signature = void(void* to, const void* from);
+
+  template <class T>
+  static void invoke(void* to, const void* from) {
+    std::construct_at(static_cast<T*>(to), *static_cast<const T*>(from));
+  }
+};
+
+// Move-constructs an object at to from the one at from and destroys the
+// latter. Keep types with throwing moves on the heap.
+struct relocate_entry {
+  using Signature = void(void* to, void* from) noexcept;
+
+  template <class T>
+  static void invoke(void* to, void* from) noexcept {
+    T* source = static_cast<T*>(from);
+    std::construct_at(static_cast<T*>(to), std::move(*source));
+    std::destroy_at(source);
+  }
+};
+
+using move_only_lifetime = entry_list<destroy_entry, relocate_entry>;
+using copyable_lifetime = entry_list<destroy_entry, copy_entry, relocate_entry>;
+
+namespace detail {
+
+using fptr_t = void (*)();
+
+// A pointer per entry and one for the type tag
+static_assert(sizeof(vtable_storage_t<inline_vtable_policy, copyable_lifetime>) == 3 * sizeof(fptr_t) + sizeof(void*));
+static_assert(sizeof(vtable_storage_t<inline_vtable_policy, move_only_lifetime>) == 2 * sizeof(fptr_t) + sizeof(void*));
+static_assert(sizeof(vtable_storage_t<static_vtable_policy, copyable_lifetime>) == sizeof(void*));
+static_assert(sizeof(vtable_storage_t<static_vtable_policy, move_only_lifetime>) == sizeof(void*));
+
+} // namespace detail
+
+} // namespace mpc
@@ -1,8 +1,15 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <random>
 #include <span>
 #include <numeric>
 #include <vector>
 
+#include "search.hpp"
+
 // Базовый алгоритм
 
 size_t binarySearch(std::span<int const> data, int value) {
@@ -22,98 +29,198 @@ size_t binarySearch(std::span<int const> data, int value) {
 
 // Macro
 
-// #define MAKE_BINARY_SEARCH(TYPE) \
-// inline size_t binarySearchWithMacros(std::span<TYPE const> data, TYPE value) { \
-//   size_t left = 0; \
-//   size_t right = data.size(); \
-//   while (right - left > 1) { \
-//     size_t middle = std::midpoint(left, right); \
-//     if (data[middle] <= value) { \
-//       left = middle; \
-//     } \
-//     else { \
-//       right = middle; \
-//     } \
-//   } \
-//   return left; \
-// }
-
-// MAKE_BINARY_SEARCH(float);
+#define MAKE_BINARY_SEARCH(TYPE) \
+inline size_t binarySearchWithMacros(std::span<TYPE const> data, TYPE value) { \
+  size_t left = 0; \
+  size_t right = data.size(); \
+  while (right - left > 1) { \
+    size_t middle = std::midpoint(left, right); \
+    if (data[middle] <= value) { \
+      left = middle; \
+    } \
+    else { \
+      right = middle; \
+    } \
+  } \
+  return left; \
+}
+
+MAKE_BINARY_SEARCH(float);
+MAKE_BINARY_SEARCH(int);
 
 
 // C-style
 
-// size_t binarySearch(std::span<std::byte const> data,
-//   size_t oneObjectSize, const std::byte* value,
-//   bool (*comparator)(const std::byte*, const std::byte*)) {
+size_t binarySearch(std::span<std::byte const> data,
+  size_t oneObjectSize, const std::byte* value,
+  bool (*comparator)(const std::byte*, const std::byte*)) {
+
+  size_t left = 0;
+  size_t right = data.size() / oneObjectSize;
+  while (right - left > 1) {
+    size_t middle = std::midpoint(left, right);
+    if (comparator(&data[middle * oneObjectSize], value)) {
+      left = middle;
+    } else {
+      right = middle;
+    }
+  }
+  return left;
+}
 
-//   size_t left = 0;
-//   size_t right = data.size() / oneObjectSize;
-//   while (right - left > 1) {
-//     size_t middle = std::midpoint(left, right);
-//     if (comparator(&data[middle * oneObjectSize], value)) {
-//       left = middle;
-//     } else {
-//       right = middle;
-//     }
-//   }
-//   return left;
-// }
+bool intLessEqual(const std::byte* lhs, const std::byte* rhs) {
+  int a, b;
+  std::memcpy(&a, lhs, sizeof(int));
+  std::memcpy(&b, rhs, sizeof(int));
+  return a <= b;
+}
 
 
 // ООП
 
-// struct IComparable
-// {
-//   virtual bool compareTo(const IComparable&) const = 0;
-
-//   virtual ~IComparable() = default;
-// };
-
-// struct Int : IComparable
-// {
-//   int value;
-
-//   bool compareTo(const IComparable& other) const override
-//   {
-//     return value < dynamic_cast<const Int&>(other).value;
-//   }
-// };
-
-// size_t binarySearch(std::span<IComparable const * const> data,
-//   const IComparable& value) {
-//   size_t left = 0;
-//   size_t right = data.size();
-//   while (right - left > 1) {
-//     size_t middle = std::midpoint(left, right);
-//     if (data[middle]->compareTo(value)) {
-//       left = middle;
-//     }
-//     else {
-//       right = middle;
-//     }
-//   }
-//   return left;
-// }
-
-
-// template<class T>
-// T binarySearchTemplate(std::span<T const> data, T value) {
-//   size_t left = 0;
-//   size_t right = data.size();
-//   while (right - left > 1) {
-//     size_t middle = std::midpoint(left, right);
-//     if (data[middle] <= value) {
-//       left = middle;
-//     }
-//     else {
-//       right = middle;
-//     }
-//   }
-//   return left;
-// }
+struct IComparable
+{
+  virtual bool compareTo(const IComparable&) const = 0;
+
+  virtual ~IComparable() = default;
+};
+
+struct Int : IComparable
+{
+  explicit Int(int value) : value(value) {}
+
+  int value;
+
+  // Как data[middle] <= value в остальных вариантах
+  bool compareTo(const IComparable& other) const override
+  {
+    return value <= dynamic_cast<const Int&>(other).value;
+  }
+};
+
+size_t binarySearch(std::span<IComparable const * const> data,
+  const IComparable& value) {
+  size_t left = 0;
+  size_t right = data.size();
+  while (right - left > 1) {
+    size_t middle = std::midpoint(left, right);
+    if (data[middle]->compareTo(value)) {
+      left = middle;
+    }
+    else {
+      right = middle;
+    }
+  }
+  return left;
+}
+
 
+// Template
+
+template<class T>
+size_t binarySearchTemplate(std::span<T const> data, T value) {
+  size_t left = 0;
+  size_t right = data.size();
+  while (right - left > 1) {
+    size_t middle = std::midpoint(left, right);
+    if (data[middle] <= value) {
+      left = middle;
+    }
+    else {
+      right = middle;
+    }
+  }
+  return left;
+}
+
+// Бенчмарк: все варианты на массивах от L1 до оперативной памяти
+
+template<class Search>
+void measure(const char* name, std::span<int const> queries, size_t expected, Search&& search) {
+  auto start = std::chrono::steady_clock::now();
+  size_t checksum = 0;
+  for (int query : queries) {
+    checksum += search(query);
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "  " << name << ": " << elapsed.count() / queries.size() << " ns";
+  if (checksum != expected) {
+    std::cout << " WRONG ANSWER";
+  }
+  std::cout << std::endl;
+}
+
+void benchmark(size_t size, std::span<int const> allQueries) {
+  std::vector<int> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<int>(3 * i);
+  }
+  std::span<int const> queries = allQueries;
+
+  std::vector<Int> objects;
+  objects.reserve(size);
+  std::vector<IComparable const*> pointers;
+  for (int x : data) {
+    objects.emplace_back(x);
+    pointers.push_back(&objects.back());
+  }
+
+  EytzingerIndex<int> eytzinger(data);
+  BTreeIndex<int> btree(data);
+
+  std::vector<int> scaled(queries.size());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    scaled[i] = static_cast<int>(static_cast<std::uint64_t>(queries[i]) % (3 * size));
+  }
+  queries = scaled;
+
+  size_t expected = 0;
+  for (int query : queries) {
+    expected += binarySearch(data, query);
+  }
+
+  std::cout << size << " elements (" << size * sizeof(int) / 1024 << " KiB):" << std::endl;
+  measure("plain", queries, expected, [&](int x) {
+    return binarySearch(data, x);
+  });
+  measure("macro", queries, expected, [&](int x) {
+    return binarySearchWithMacros(std::span<int const>(data), x);
+  });
+  measure("C-style", queries, expected, [&](int x) {
+    return binarySearch(std::as_bytes(std::span<int const>(data)), sizeof(int),
+      reinterpret_cast<const std::byte*>(&x), &intLessEqual);
+  });
+  measure("OOP", queries, expected, [&](int x) {
+    return binarySearch(pointers, Int(x));
+  });
+  measure("template", queries, expected, [&](int x) {
+    return binarySearchTemplate<int>(data, x);
+  });
+  measure("branchless", queries, expected, [&](int x) {
+    return branchlessBinarySearch<int>(data, x);
+  });
+  measure("Eytzinger", queries, expected, [&](int x) {
+    return eytzinger.search(x);
+  });
+  measure("B-tree", queries, expected, [&](int x) {
+    return btree.search(x);
+  });
+}
+
+// Аргумент: логарифм самого большого размера массива, по умолчанию 24
 int main(int argc, char** argv)
 {
+  size_t maxLog = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 24;
+
+  std::mt19937 generator(42);
+  std::vector<int> queries(1 << 20);
+  for (int& query : queries) {
+    query = static_cast<int>(generator() >> 1);
+  }
+
+  for (size_t log = 10; log <= maxLog; log += 3) {
+    benchmark(size_t{1} << log, queries);
+  }
   return 0;
 }
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Быстрый конец спектра из main.cpp. Все варианты отвечают на тот же
+// вопрос, что и binarySearch: индекс последнего элемента <= value в
+// отсортированном массиве (или 0, если такого нет).
+//
+// - branchlessBinarySearch: тот же поиск без условных переходов, вместо
+//   них cmov, так что нечему мисспредиктиться.
+// - EytzingerIndex: копия массива в порядке обхода дерева в ширину.
+//   Потомки узла лежат рядом, поэтому можно заранее подгружать в кэш
+//   узлы на несколько уровней вперёд.
+// - BTreeIndex: статическое B-дерево, узел которого занимает одну
+//   кэш-линию. Внутри узла сравниваем со всеми ключами сразу (для int
+//   через SSE2, для остальных T циклом, который векторизует компилятор).
+
+inline constexpr std::size_t kCacheLine = 64;
+
+template<class T>
+std::size_t branchlessBinarySearch(std::span<T const> data, T const& value) {
+  if (data.empty()) {
+    return 0;
+  }
+
+  T const* base = data.data();
+  std::size_t length = data.size();
+  while (length > 1) {
+    std::size_t half = length / 2;
+    base = (base[half] <= value) ? base + half : base;
+    length -= half;
+  }
+  return base - data.data();
+}
+
+namespace detail {
+
+inline void prefetch(void const* address) {
+#if defined(__GNUC__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+} // namespace detail
+
+template<class T>
+class EytzingerIndex {
+public:
+  explicit EytzingerIndex(std::span<T const> data)
+    : tree_(data.size() + 1), positions_(data.size() + 1, data.size()) {
+    std::size_t next = 0;
+    build(data, next, 1);
+  }
+
+  std::size_t search(T const& value) const {
+    // Столько элементов в кэш-линии, столько же узлов на 4 уровня ниже
+    constexpr std::size_t kAhead = std::max<std::size_t>(1, kCacheLine / sizeof(T));
+
+    std::size_t k = 1;
+    while (k < tree_.size()) {
+      // Через uintptr_t: адрес может оказаться за концом массива
+      detail::prefetch(reinterpret_cast<void const*>(
+        reinterpret_cast<std::uintptr_t>(tree_.data()) + k * kAhead * sizeof(T)));
+      k = 2 * k + (tree_[k] <= value);
+    }
+    // Убираем повороты направо и последний поворот налево: остаётся
+    // первый элемент > value
+    k >>= std::countr_one(k) + 1;
+
+    std::size_t upper = k == 0 ? tree_.size() - 1 : positions_[k];
+    return upper == 0 ? 0 : upper - 1;
+  }
+
+private:
+  void build(std::span<T const> data, std::size_t& next, std::size_t k) {
+    if (k < tree_.size()) {
+      build(data, next, 2 * k);
+      tree_[k] = data[next];
+      positions_[k] = next++;
+      build(data, next, 2 * k + 1);
+    }
+  }
+
+  // Нумерация с единицы, tree_[0] не используется
+  std::vector<T> tree_;
+  std::vector<std::size_t> positions_;
+};
+
+template<class T>
+class BTreeIndex {
+  static constexpr std::size_t B = std::max<std::size_t>(2, kCacheLine / sizeof(T));
+
+  struct alignas(kCacheLine) Node {
+    T keys[B];
+  };
+
+public:
+  explicit BTreeIndex(std::span<T const> data)
+    : size_(data.size())
+    , nodes_((data.size() + B - 1) / B)
+    , positions_(nodes_.size() * B, data.size()) {
+    std::size_t next = 0;
+    build(data, next, 0);
+  }
+
+  std::size_t search(T const& value) const {
+    // Позицию кандидата достаём один раз в конце, а не на каждом уровне
+    std::size_t candidate = positions_.size();
+    std::size_t k = 0;
+    while (k < nodes_.size()) {
+      std::size_t i = countNotGreater(nodes_[k], value);
+      candidate = i < B ? k * B + i : candidate;
+      k = child(k, i);
+    }
+    std::size_t upper = candidate == positions_.size() ? size_ : positions_[candidate];
+    return upper == 0 ? 0 : upper - 1;
+  }
+
+private:
+  static std::size_t child(std::size_t k, std::size_t i) {
+    return k * (B + 1) + i + 1;
+  }
+
+  // Ключи в узле отсортированы, так что это индекс первого > value
+  static std::size_t countNotGreater(Node const& node, T const& value) {
+#if defined(__SSE2__)
+    if constexpr (std::same_as<T, std::int32_t> && B == 16) {
+      // Сжимаем 16 сравнений в 16 бит маски. Ключи отсортированы, так что
+      // единицы идут подряд с конца, и хватает countr_zero: popcount без
+      // -mpopcnt превращается в библиотечный вызов
+      __m128i x = _mm_set1_epi32(value);
+      auto greater = [&](std::size_t j) {
+        return _mm_cmpgt_epi32(_mm_load_si128(reinterpret_cast<__m128i const*>(node.keys + j)), x);
+      };
+      __m128i low = _mm_packs_epi32(greater(0), greater(4));
+      __m128i high = _mm_packs_epi32(greater(8), greater(12));
+      auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(low, high)));
+      return std::countr_zero(mask | (1u << B));
+    }
+#endif
+    std::size_t count = 0;
+    for (std::size_t j = 0; j < B; ++j) {
+      count += node.keys[j] <= value;
+    }
+    return count;
+  }
+
+  // Обходим дерево в симметричном порядке и раскладываем элементы по
+  // порядку. Хвост последних узлов добиваем максимумом, его позиции
+  // указывают за конец массива.
+  void build(std::span<T const> data, std::size_t& next, std::size_t k) {
+    if (k >= nodes_.size()) {
+      return;
+    }
+    for (std::size_t i = 0; i < B; ++i) {
+      build(data, next, child(k, i));
+      if (next < data.size()) {
+        nodes_[k].keys[i] = data[next];
+        positions_[k * B + i] = next++;
+      } else {
+        nodes_[k].keys[i] = std::numeric_limits<T>::max();
+      }
+    }
+    build(data, next, child(k, B));
+  }
+
+  std::size_t size_;
+  std::vector<Node> nodes_;
+  std::vector<std::size_t> positions_;
+};
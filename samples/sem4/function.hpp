@@ -1,5 +1,314 @@
 #pragma once
 
-// TODO: implement
+#include <lib/vtable.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
 #include <functional>
-#define Function std::function
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Function<R(Args...), Capacity> keeps callables of up to Capacity bytes
+// inline, so the typical lambda never allocates. Calling it is a single
+// indirect call through the invoker pointer stored in the object itself;
+// copying, moving and destruction go through a shared static table (see
+// lib/vtable.hpp), so they cost one more indirection but only one pointer
+// of space. MoveOnlyFunction is the same without the copy entry, and
+// FunctionRef is a non-owning (object pointer, invoker) pair.
+//
+// A noexcept signature makes operator() noexcept and only accepts
+// callables that do not throw.
+
+inline constexpr std::size_t kDefaultFunctionCapacity = 48;
+
+namespace detail {
+
+template <class Signature>
+struct CallOperatorSignature;
+
+template <class R, class C, class... Args, bool Noexcept>
+struct CallOperatorSignature<R (C::*)(Args...) noexcept(Noexcept)> {
+  using Type = R(Args...) noexcept(Noexcept);
+};
+
+template <class R, class C, class... Args, bool Noexcept>
+struct CallOperatorSignature<R (C::*)(Args...) const noexcept(Noexcept)> {
+  using Type = R(Args...) noexcept(Noexcept);
+};
+
+template <class R, class C, class... Args, bool Noexcept>
+struct CallOperatorSignature<R (C::*)(Args...) & noexcept(Noexcept)> {
+  using Type = R(Args...) noexcept(Noexcept);
+};
+
+template <class R, class C, class... Args, bool Noexcept>
+struct CallOperatorSignature<R (C::*)(Args...) const & noexcept(Noexcept)> {
+  using Type = R(Args...) noexcept(Noexcept);
+};
+
+template <class F, bool Noexcept, class R, class... Args>
+concept InvocableAs =
+  (Noexcept ? std::is_nothrow_invocable_r_v<R, F, Args...> : std::is_invocable_r_v<R, F, Args...>);
+
+template <class R, class F, class... Args>
+R invokeAs(F&& f, Args&&... args) {
+  if constexpr (std::is_void_v<R>) {
+    std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+  } else {
+    return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+  }
+}
+
+// Owns a T on the heap while being pointer-sized and nothrow movable
+// itself, so large callables still go through the inline lifetime entries.
+template <class T>
+class HeapBox {
+public:
+  template <class... Args>
+  explicit HeapBox(std::in_place_t, Args&&... args)
+    : object_(new T(std::forward<Args>(args)...)) {
+  }
+
+  HeapBox(const HeapBox& other)
+    : object_(new T(*other.object_)) {
+  }
+
+  HeapBox(HeapBox&& other) noexcept
+    : object_(std::exchange(other.object_, nullptr)) {
+  }
+
+  HeapBox& operator=(const HeapBox&) = delete;
+  HeapBox& operator=(HeapBox&&) = delete;
+
+  ~HeapBox() {
+    delete object_;
+  }
+
+  T& get() const noexcept {
+    return *object_;
+  }
+
+private:
+  T* object_;
+};
+
+template <class T, std::size_t Capacity>
+concept FitsInline =
+  sizeof(T) <= Capacity
+  && alignof(T) <= alignof(std::max_align_t)
+  && std::is_nothrow_move_constructible_v<T>;
+
+template <class Signature, std::size_t Capacity, class Lifetime>
+class FunctionBase;
+
+template <class R, class... Args, bool Noexcept, std::size_t Capacity, class Lifetime>
+class FunctionBase<R(Args...) noexcept(Noexcept), Capacity, Lifetime> {
+  static constexpr bool kCopyable = std::same_as<Lifetime, mpc::copyable_lifetime>;
+  // A heap-allocated callable needs room for a pointer
+  static constexpr std::size_t kStorageSize = std::max(Capacity, sizeof(void*));
+
+  using Invoker = R (*)(void*, Args&&...) noexcept(Noexcept);
+  using Table = mpc::vtable_storage_t<mpc::static_vtable_policy, Lifetime>;
+
+  template <class F>
+  using Stored = std::conditional_t<FitsInline<F, kStorageSize>, F, HeapBox<F>>;
+
+public:
+  FunctionBase() noexcept = default;
+
+  FunctionBase(std::nullptr_t) noexcept {
+  }
+
+  template <class F, class D = std::decay_t<F>>
+    requires (!std::derived_from<D, FunctionBase>)
+      && InvocableAs<D&, Noexcept, R, Args...>
+      && (!kCopyable || std::copy_constructible<D>)
+  FunctionBase(F&& f) {
+    // A function passed by reference decays to a pointer that is never null
+    using P = std::remove_cvref_t<F>;
+    if constexpr (std::is_pointer_v<P> || std::is_member_pointer_v<P>) {
+      if (f == nullptr) {
+        return;
+      }
+    }
+
+    using S = Stored<D>;
+    if constexpr (std::same_as<S, D>) {
+      ::new (static_cast<void*>(storage_)) D(std::forward<F>(f));
+      invoker_ = &invokeInline<D>;
+    } else {
+      ::new (static_cast<void*>(storage_)) S(std::in_place, std::forward<F>(f));
+      invoker_ = &invokeHeap<D>;
+    }
+    table_ = Table::template make<S>();
+  }
+
+  FunctionBase(const FunctionBase& other) requires kCopyable
+    : invoker_(other.invoker_), table_(other.table_) {
+    if (!table_.empty()) {
+      table_.template call<mpc::copy_entry>(storage_, other.storage_);
+    }
+  }
+
+  FunctionBase(FunctionBase&& other) noexcept {
+    steal(other);
+  }
+
+  FunctionBase& operator=(const FunctionBase& other) requires kCopyable {
+    if (this != &other) {
+      *this = FunctionBase(other);
+    }
+    return *this;
+  }
+
+  FunctionBase& operator=(FunctionBase&& other) noexcept {
+    if (this != &other) {
+      reset();
+      steal(other);
+    }
+    return *this;
+  }
+
+  FunctionBase& operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  ~FunctionBase() {
+    reset();
+  }
+
+  R operator()(Args... args) const noexcept(Noexcept) {
+    return invoker_(storage_, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const noexcept {
+    return invoker_ != &invokeEmpty;
+  }
+
+  // Whether a callable of type F would be stored without allocating
+  template <class F>
+  static constexpr bool kStoresInline = FitsInline<std::decay_t<F>, kStorageSize>;
+
+private:
+  // Calling an empty function terminates for noexcept signatures
+  static R invokeEmpty(void*, Args&&...) noexcept(Noexcept) {
+    if constexpr (Noexcept) {
+      std::terminate();
+    } else {
+      throw std::bad_function_call{};
+    }
+  }
+
+  template <class F>
+  static R invokeInline(void* storage, Args&&... args) noexcept(Noexcept) {
+    return invokeAs<R>(*std::launder(static_cast<F*>(storage)), std::forward<Args>(args)...);
+  }
+
+  template <class F>
+  static R invokeHeap(void* storage, Args&&... args) noexcept(Noexcept) {
+    return invokeAs<R>(std::launder(static_cast<HeapBox<F>*>(storage))->get(), std::forward<Args>(args)...);
+  }
+
+  void steal(FunctionBase& other) noexcept {
+    invoker_ = std::exchange(other.invoker_, &invokeEmpty);
+    table_ = std::exchange(other.table_, Table{});
+    if (!table_.empty()) {
+      table_.template call<mpc::relocate_entry>(storage_, other.storage_);
+    }
+  }
+
+  void reset() noexcept {
+    if (!table_.empty()) {
+      table_.template call<mpc::destroy_entry>(storage_);
+    }
+    invoker_ = &invokeEmpty;
+    table_ = Table{};
+  }
+
+  // Never null, so that a call needs no branch
+  Invoker invoker_ = &invokeEmpty;
+  Table table_;
+  alignas(std::max_align_t) mutable std::byte storage_[kStorageSize];
+};
+
+} // namespace detail
+
+template <class Signature, std::size_t Capacity = kDefaultFunctionCapacity>
+class Function : public detail::FunctionBase<Signature, Capacity, mpc::copyable_lifetime> {
+  using Base = detail::FunctionBase<Signature, Capacity, mpc::copyable_lifetime>;
+
+public:
+  using Base::Base;
+};
+
+template <class R, class... Args, bool Noexcept>
+Function(R (*)(Args...) noexcept(Noexcept)) -> Function<R(Args...) noexcept(Noexcept)>;
+
+template <class F>
+Function(F) -> Function<typename detail::CallOperatorSignature<decltype(&F::operator())>::Type>;
+
+template <class Signature, std::size_t Capacity = kDefaultFunctionCapacity>
+class MoveOnlyFunction : public detail::FunctionBase<Signature, Capacity, mpc::move_only_lifetime> {
+  using Base = detail::FunctionBase<Signature, Capacity, mpc::move_only_lifetime>;
+
+public:
+  using Base::Base;
+};
+
+template <class R, class... Args, bool Noexcept>
+MoveOnlyFunction(R (*)(Args...) noexcept(Noexcept)) -> MoveOnlyFunction<R(Args...) noexcept(Noexcept)>;
+
+template <class F>
+MoveOnlyFunction(F) -> MoveOnlyFunction<typename detail::CallOperatorSignature<decltype(&F::operator())>::Type>;
+
+// Refers to a callable that must outlive it
+template <class Signature>
+class FunctionRef;
+
+template <class R, class... Args, bool Noexcept>
+class FunctionRef<R(Args...) noexcept(Noexcept)> {
+  using Invoker = R (*)(void*, Args&&...) noexcept(Noexcept);
+
+public:
+  template <class F>
+    requires (!std::same_as<std::remove_cvref_t<F>, FunctionRef>)
+      && (!std::is_function_v<std::remove_reference_t<F>>)
+      && detail::InvocableAs<std::remove_reference_t<F>&, Noexcept, R, Args...>
+  FunctionRef(F&& f) noexcept
+    : object_(const_cast<void*>(static_cast<const void*>(std::addressof(f))))
+    , invoker_(&invokeObject<std::remove_reference_t<F>>) {
+  }
+
+  template <class F>
+    requires std::is_function_v<F> && detail::InvocableAs<F&, Noexcept, R, Args...>
+  FunctionRef(F* f) noexcept
+    : object_(reinterpret_cast<void*>(f))
+    , invoker_(&invokeFunction<F>) {
+  }
+
+  R operator()(Args... args) const noexcept(Noexcept) {
+    return invoker_(object_, std::forward<Args>(args)...);
+  }
+
+private:
+  template <class F>
+  static R invokeObject(void* object, Args&&... args) noexcept(Noexcept) {
+    return detail::invokeAs<R>(*static_cast<F*>(object), std::forward<Args>(args)...);
+  }
+
+  template <class F>
+  static R invokeFunction(void* function, Args&&... args) noexcept(Noexcept) {
+    return detail::invokeAs<R>(*reinterpret_cast<F*>(function), std::forward<Args>(args)...);
+  }
+
+  void* object_;
+  Invoker invoker_;
+};
+
+template <class R, class... Args, bool Noexcept>
+FunctionRef(R (*)(Args...) noexcept(Noexcept)) -> FunctionRef<R(Args...) noexcept(Noexcept)>;
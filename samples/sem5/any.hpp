@@ -1,4 +1,285 @@
 #pragma once
 
-#include <any>
-#define Any std::any
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+// BasicAny<Capacity> stores copyable values of up to Capacity bytes
+// (alignof(std::max_align_t) at most, nothrow movable) inline, anything
+// else on the heap. Any uses 32 bytes, enough for std::string in the
+// common standard libraries.
+//
+// Every stored type gets its own static table, and the address of that
+// table is the type's identity: any_cast is a pointer comparison, no RTTI
+// involved. The table also says which operations are trivial, so copying
+// and moving trivially copyable payloads is a memcpy of the buffer, and
+// moving a heap-allocated one only copies the pointer.
+
+class BadAnyCast : public std::bad_cast {
+public:
+  const char* what() const noexcept override {
+    return "bad any cast";
+  }
+};
+
+namespace detail {
+
+struct AnyTable {
+  void (*copy)(void* to, const void* from);
+  void (*relocate)(void* to, void* from) noexcept;
+  void (*destroy)(void* self) noexcept;
+
+  bool trivial_copy;
+  bool trivial_relocate;
+  bool trivial_destroy;
+};
+
+template <class T, std::size_t Capacity>
+concept AnyFitsInline =
+  sizeof(T) <= Capacity
+  && alignof(T) <= alignof(std::max_align_t)
+  && std::is_nothrow_move_constructible_v<T>;
+
+template <class T>
+struct InlineAnyOps {
+  static T* get(void* storage) noexcept {
+    return std::launder(static_cast<T*>(storage));
+  }
+
+  static const T* get(const void* storage) noexcept {
+    return std::launder(static_cast<const T*>(storage));
+  }
+
+  static void copy(void* to, const void* from) {
+    ::new (to) T(*get(from));
+  }
+
+  static void relocate(void* to, void* from) noexcept {
+    T* source = get(from);
+    ::new (to) T(std::move(*source));
+    source->~T();
+  }
+
+  static void destroy(void* self) noexcept {
+    get(self)->~T();
+  }
+
+  static constexpr AnyTable kTable = {
+    &copy, &relocate, &destroy,
+    std::is_trivially_copyable_v<T>,
+    std::is_trivially_copyable_v<T>,
+    std::is_trivially_destructible_v<T>,
+  };
+};
+
+// The buffer holds a T*
+template <class T>
+struct HeapAnyOps {
+  static T* get(void* storage) noexcept {
+    return *static_cast<T**>(storage);
+  }
+
+  static const T* get(const void* storage) noexcept {
+    return *static_cast<T* const*>(storage);
+  }
+
+  static void copy(void* to, const void* from) {
+    *static_cast<T**>(to) = new T(*get(from));
+  }
+
+  static void relocate(void* to, void* from) noexcept {
+    *static_cast<T**>(to) = get(from);
+  }
+
+  static void destroy(void* self) noexcept {
+    delete get(self);
+  }
+
+  static constexpr AnyTable kTable = {
+    &copy, &relocate, &destroy,
+    false,
+    true,
+    false,
+  };
+};
+
+} // namespace detail
+
+template <std::size_t Capacity>
+class BasicAny {
+  static constexpr std::size_t kStorageSize = Capacity < sizeof(void*) ? sizeof(void*) : Capacity;
+
+  template <class T>
+  using Ops = std::conditional_t<
+    detail::AnyFitsInline<T, kStorageSize>,
+    detail::InlineAnyOps<T>,
+    detail::HeapAnyOps<T>>;
+
+public:
+  BasicAny() noexcept = default;
+
+  template <class T, class D = std::decay_t<T>>
+    requires (!std::same_as<D, BasicAny>) && std::copy_constructible<D>
+  BasicAny(T&& value) {
+    emplace<D>(std::forward<T>(value));
+  }
+
+  template <class T, class... Args>
+    requires std::copy_constructible<T> && std::constructible_from<T, Args...>
+  explicit BasicAny(std::in_place_type_t<T>, Args&&... args) {
+    emplace<T>(std::forward<Args>(args)...);
+  }
+
+  BasicAny(const BasicAny& other) {
+    copyFrom(other);
+  }
+
+  BasicAny(BasicAny&& other) noexcept {
+    stealFrom(other);
+  }
+
+  BasicAny& operator=(const BasicAny& other) {
+    if (this != &other) {
+      BasicAny copy(other);
+      reset();
+      stealFrom(copy);
+    }
+    return *this;
+  }
+
+  BasicAny& operator=(BasicAny&& other) noexcept {
+    if (this != &other) {
+      reset();
+      stealFrom(other);
+    }
+    return *this;
+  }
+
+  template <class T, class D = std::decay_t<T>>
+    requires (!std::same_as<D, BasicAny>) && std::copy_constructible<D>
+  BasicAny& operator=(T&& value) {
+    // value may be, or be part of, the object held now, so it is copied
+    // out before that one is destroyed
+    BasicAny copy(std::forward<T>(value));
+    reset();
+    stealFrom(copy);
+    return *this;
+  }
+
+  ~BasicAny() {
+    reset();
+  }
+
+  template <class T, class... Args>
+    requires std::copy_constructible<T> && std::constructible_from<T, Args...>
+  T& emplace(Args&&... args) {
+    reset();
+    T* object;
+    if constexpr (detail::AnyFitsInline<T, kStorageSize>) {
+      object = ::new (static_cast<void*>(storage_)) T(std::forward<Args>(args)...);
+    } else {
+      object = new T(std::forward<Args>(args)...);
+      *reinterpret_cast<T**>(storage_) = object;
+    }
+    table_ = &Ops<T>::kTable;
+    return *object;
+  }
+
+  void reset() noexcept {
+    if (table_ != nullptr && !table_->trivial_destroy) {
+      table_->destroy(storage_);
+    }
+    table_ = nullptr;
+  }
+
+  bool has_value() const noexcept {
+    return table_ != nullptr;
+  }
+
+  template <class T>
+  bool holds() const noexcept {
+    return table_ == &Ops<T>::kTable;
+  }
+
+  // Whether a T would be stored without allocating
+  template <class T>
+  static constexpr bool kStoresInline = detail::AnyFitsInline<std::decay_t<T>, kStorageSize>;
+
+  template <class T>
+  friend const T* any_cast(const BasicAny* any) noexcept {
+    if (any == nullptr || !any->template holds<T>()) {
+      return nullptr;
+    }
+    return Ops<T>::get(any->storage_);
+  }
+
+  template <class T>
+  friend T* any_cast(BasicAny* any) noexcept {
+    if (any == nullptr || !any->template holds<T>()) {
+      return nullptr;
+    }
+    return Ops<T>::get(any->storage_);
+  }
+
+private:
+  void copyFrom(const BasicAny& other) {
+    if (other.table_ == nullptr) {
+      return;
+    }
+    if (other.table_->trivial_copy) {
+      std::memcpy(storage_, other.storage_, kStorageSize);
+    } else {
+      other.table_->copy(storage_, other.storage_);
+    }
+    table_ = other.table_;
+  }
+
+  void stealFrom(BasicAny& other) noexcept {
+    if (other.table_ == nullptr) {
+      return;
+    }
+    if (other.table_->trivial_relocate) {
+      std::memcpy(storage_, other.storage_, kStorageSize);
+    } else {
+      other.table_->relocate(storage_, other.storage_);
+    }
+    table_ = std::exchange(other.table_, nullptr);
+  }
+
+  const detail::AnyTable* table_ = nullptr;
+  alignas(std::max_align_t) std::byte storage_[kStorageSize];
+};
+
+using Any = BasicAny<32>;
+
+template <class T, std::size_t Capacity>
+  requires std::constructible_from<T, const std::remove_cvref_t<T>&>
+T any_cast(const BasicAny<Capacity>& any) {
+  if (auto* value = any_cast<std::remove_cvref_t<T>>(&any)) {
+    return static_cast<T>(*value);
+  }
+  throw BadAnyCast{};
+}
+
+template <class T, std::size_t Capacity>
+  requires std::constructible_from<T, std::remove_cvref_t<T>&>
+T any_cast(BasicAny<Capacity>& any) {
+  if (auto* value = any_cast<std::remove_cvref_t<T>>(&any)) {
+    return static_cast<T>(*value);
+  }
+  throw BadAnyCast{};
+}
+
+template <class T, std::size_t Capacity>
+  requires std::constructible_from<T, std::remove_cvref_t<T>>
+T any_cast(BasicAny<Capacity>&& any) {
+  if (auto* value = any_cast<std::remove_cvref_t<T>>(&any)) {
+    return static_cast<T>(std::move(*value));
+  }
+  throw BadAnyCast{};
+}
@@ -4,9 +4,101 @@
 #include <utility>
 #include <array>
 #include <variant>
+#include <any>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <vector>
 #include "any.hpp"
 
 
+struct Tracked {
+  inline static int alive = 0;
+
+  Tracked() { ++alive; }
+  Tracked(const Tracked&) { ++alive; }
+  Tracked(Tracked&&) noexcept { ++alive; }
+  ~Tracked() { --alive; }
+};
+
+void test_any() {
+  static_assert(Any::kStoresInline<int>);
+  static_assert(Any::kStoresInline<std::string> == (sizeof(std::string) <= 32));
+  static_assert(!Any::kStoresInline<std::array<char, 33>>);
+  static_assert(BasicAny<64>::kStoresInline<std::array<char, 64>>);
+
+  Any empty;
+  assert(!empty.has_value());
+  assert(any_cast<int>(&empty) == nullptr);
+
+  Any a = 1.5;
+  assert(a.holds<double>() && !a.holds<float>());
+  assert(any_cast<int>(&a) == nullptr);
+  [[maybe_unused]] bool thrown = false;
+  try {
+    any_cast<int>(a);
+  } catch (const BadAnyCast&) {
+    thrown = true;
+  }
+  assert(thrown);
+
+  // A heap-allocated payload moves by pointer
+  using Big = std::array<char, 100>;
+  Any big = Big{'x'};
+  [[maybe_unused]] const char* data = any_cast<Big>(&big)->data();
+  Any moved = std::move(big);
+  assert(!big.has_value());
+  assert(any_cast<Big>(&moved)->data() == data);
+
+  Any copy = moved;
+  assert(any_cast<Big&>(copy)[0] == 'x');
+  assert(any_cast<Big>(&copy)->data() != data);
+
+  {
+    Any t = Tracked{};
+    Any u = t;
+    Any v = std::move(u);
+    assert(Tracked::alive == 2);
+    v = 5;
+    assert(Tracked::alive == 1);
+  }
+  assert(Tracked::alive == 0);
+
+  Any s(std::in_place_type<std::string>, 3, 'z');
+  any_cast<std::string&>(s) += "!";
+  assert(any_cast<const std::string&>(s) == "zzz!");
+  assert(any_cast<std::string>(std::move(s)) == "zzz!");
+
+  // Assigning a value that lives inside the Any itself
+  Any self = std::string(100, 'y');
+  self = any_cast<std::string&>(self);
+  assert(any_cast<const std::string&>(self) == std::string(100, 'y'));
+}
+
+template <class AnyT, class Cast, class T>
+double bench(const T& value, Cast cast) {
+  constexpr int kIterations = 1'000'000;
+  std::vector<AnyT> boxes(16);
+
+  auto start = std::chrono::steady_clock::now();
+  std::size_t hits = 0;
+  for (int i = 0; i < kIterations; ++i) {
+    AnyT box = value;
+    boxes[i % boxes.size()] = std::move(box);
+    hits += cast(boxes[(i + 1) % boxes.size()]) != nullptr;
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  assert(hits >= kIterations - boxes.size());
+  return elapsed.count() / kIterations;
+}
+
+template <class T>
+void bench_against_std(const char* name, const T& value) {
+  double ours = bench<Any>(value, [](Any& a) { return any_cast<T>(&a); });
+  double theirs = bench<std::any>(value, [](std::any& a) { return std::any_cast<T>(&a); });
+  std::cout << name << ": Any " << ours << " ns, std::any " << theirs << " ns per box/move/cast" << std::endl;
+}
 
 int main() {
   Any a = 42;
@@ -18,5 +110,10 @@ int main() {
 
   std::cout << any_cast<std::string>(a) << std::endl;
 
+  test_any();
+
+  bench_against_std("int", 42);
+  bench_against_std("std::string", std::string("Hello!"));
+
   return 0;
 }
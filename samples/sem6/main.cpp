@@ -7,6 +7,16 @@
 #include <variant>
 #include <any>
 #include <tuple>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include <cassert>
+
+#include "type_id.hpp"
 
 template <class T>
 constexpr bool DepFalse = false;
@@ -21,31 +31,11 @@ constexpr bool DepFalse = false;
   }                            \
   (std::make_index_sequence<SIZE>{});
 
-template <int N>
-struct Tag
-{
-  friend auto loophole(Tag<N>);
-};
-template <int N>
-struct Loophole
-{
-  friend auto loophole(Tag<N>) {};
-};
-
-template <size_t I = 0, auto L = []() {}>
-consteval size_t counter()
-{
-  if constexpr (requires { loophole(Tag<I>{}); }) {
-    return counter<I + 1, L>();
-  } else {
-    (void) Loophole<I>{};
-    return I;
-  }
-}
+struct Arrays;
 
-std::array<int, counter()> a;
-std::array<int, counter()> b;
-std::array<int, counter()> c;
+std::array<int, counter<Arrays>()> a;
+std::array<int, counter<Arrays>()> b;
+std::array<int, counter<Arrays>()> c;
 
 template<auto V>
 auto helper() { return __PRETTY_FUNCTION__; }
@@ -60,6 +50,108 @@ struct Foo
   int c;
 };
 
+// Message routing: one handler per message type, found by the type of the
+// message
+
+struct Ping { int id; };
+struct Pong { int id; };
+struct Move { float dx, dy; };
+struct Resize { float scale; };
+struct Text { std::string text; };
+struct Close {};
+struct Ack { std::uint64_t sequence; };
+struct Error { int code; };
+
+struct Messages : TypeRegistry<Messages, Ping, Pong, Move, Resize, Text, Close, Ack, Error> {};
+
+static_assert(type_id_v<Messages, Ping> == 0);
+static_assert(type_id_v<Messages, Error> == 7);
+static_assert(Messages::size == 8);
+static_assert(!Messages::contains<int>);
+
+// Within one TU the counter gives dense IDs too, in the order of first use
+struct Scratch;
+static_assert(AutoTypeId<Scratch, float>::value == 0);
+static_assert(AutoTypeId<Scratch, int>::value == 1);
+static_assert(AutoTypeId<Scratch, float>::value == 0);
+
+struct Envelope {
+  std::size_t id;
+  std::type_index type;
+  const void* payload;
+};
+
+using Handler = void (*)(const void*, std::uint64_t&);
+
+std::uint64_t digest(const Ping& m) { return m.id; }
+std::uint64_t digest(const Pong& m) { return m.id + 1; }
+std::uint64_t digest(const Move& m) { return static_cast<std::uint64_t>(m.dx + m.dy); }
+std::uint64_t digest(const Resize& m) { return static_cast<std::uint64_t>(m.scale); }
+std::uint64_t digest(const Text& m) { return m.text.size(); }
+std::uint64_t digest(const Close&) { return 7; }
+std::uint64_t digest(const Ack& m) { return m.sequence; }
+std::uint64_t digest(const Error& m) { return m.code; }
+
+template<class T>
+void handle(const void* payload, std::uint64_t& state) {
+  state = state * 31 + digest(*static_cast<const T*>(payload));
+}
+
+constexpr auto kHandlers = Messages::make_table<Handler>([]<class T>() -> Handler {
+  return &handle<T>;
+});
+
+void route(const Envelope& envelope, std::uint64_t& state) {
+  kHandlers[envelope.id](envelope.payload, state);
+}
+
+template<class... Ts>
+std::unordered_map<std::type_index, Handler> make_handler_map(TypeRegistry<Messages, Ts...>) {
+  return {{typeid(Ts), &handle<Ts>}...};
+}
+
+template<class F>
+void time_routing(const char* name, const std::vector<Envelope>& envelopes, F&& route) {
+  std::uint64_t state = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < 10; ++repeat) {
+    for (const Envelope& envelope : envelopes) {
+      route(envelope, state);
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << name << ": " << elapsed.count() / (10 * envelopes.size()) << " ns per message"
+            << " (state " << state << ")\n";
+}
+
+void bench_routing() {
+  std::tuple<Ping, Pong, Move, Resize, Text, Close, Ack, Error> samples{
+    {1}, {2}, {0.5f, 1.5f}, {2.f}, {"hello"}, {}, {42}, {-1}};
+
+  // The ID and the type_index are both computed once, when the message
+  // is sent, only the lookup is measured
+  std::vector<Envelope> kinds;
+  FOR_TEMPLATE(I)
+  {
+    using T = std::tuple_element_t<I, decltype(samples)>;
+    kinds.push_back({type_id_v<Messages, T>, typeid(T), &std::get<I>(samples)});
+  }
+  END_FOR_TEMPLATE(std::tuple_size_v<decltype(samples)>);
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<std::size_t> pick(0, kinds.size() - 1);
+  std::vector<Envelope> envelopes;
+  for (int i = 0; i < 1'000'000; ++i) {
+    envelopes.push_back(kinds[pick(generator)]);
+  }
+
+  auto handlers = make_handler_map(Messages{});
+  time_routing("array by type ID", envelopes, route);
+  time_routing("unordered_map<type_index>", envelopes, [&](const Envelope& envelope, std::uint64_t& state) {
+    handlers.find(envelope.type)->second(envelope.payload, state);
+  });
+}
+
 int main()
 {
   std::cout << a.size() << '\n';
@@ -75,5 +167,7 @@ int main()
 
   std::cout << helper<&Foo::a>() << '\n';
 
+  bench_routing();
+
   return 0;
 }
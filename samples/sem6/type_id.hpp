@@ -0,0 +1,100 @@
+#pragma once
+
+#include <lib/indexing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Dense compile-time type IDs: the types of a domain get the IDs 0, 1, 2,
+// ..., so a dispatch table is a plain array indexed by ID instead of a
+// hash map keyed by std::type_index or a chain of dynamic_casts.
+//
+// The loophole counter from main.cpp is stateful: its value depends on
+// what the compiler has instantiated so far in this translation unit.
+// IDs taken from it (AutoTypeId) differ between TUs that use the types in
+// a different order, and an inline variable with different values in
+// different TUs is an ODR violation nobody will diagnose. They are only
+// fine within a single TU.
+//
+// TypeRegistry is the safe version. The domain lists its types once, in a
+// header, and the ID is the position in that list, the same in every TU:
+//
+//   struct Shapes : TypeRegistry<Shapes, Circle, Square> {};
+//   static_assert(type_id_v<Shapes, Square> == 1);
+//
+// Defining the registry takes the domain's counter, so a second registry
+// of the same domain in a TU, or AutoTypeId of the domain used before it,
+// fails to compile. Types that are not in the list have no ID.
+
+namespace type_id_detail {
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+
+// Calling loophole(Tag) needs the return type, which is only known once
+// the Loophole with the same N has been instantiated
+template<class Domain, std::size_t N>
+struct Tag {
+  friend auto loophole(Tag);
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+template<class Domain, std::size_t N>
+struct Loophole {
+  friend auto loophole(Tag<Domain, N>) {}
+};
+
+} // namespace type_id_detail
+
+// The number of calls made so far for the Domain in this TU
+template<class Domain, std::size_t I = 0, auto Unique = [] {}>
+consteval std::size_t counter() {
+  if constexpr (requires { loophole(type_id_detail::Tag<Domain, I>{}); }) {
+    return counter<Domain, I + 1, Unique>();
+  } else {
+    (void) type_id_detail::Loophole<Domain, I>{};
+    return I;
+  }
+}
+
+// In the order of first use, only within one TU, see above
+template<class Domain, class T>
+struct AutoTypeId {
+  static constexpr std::size_t value = counter<Domain>();
+};
+
+template<class Domain, class... Ts>
+struct TypeRegistry {
+  static_assert(counter<Domain>() == 0, "The domain already has an ID registry or AutoTypeIds");
+  static_assert(
+    []<std::size_t... Is>(std::index_sequence<Is...>) {
+      return ((mpc::index_of_v<Ts, mpc::types<Ts...>> == Is) && ...);
+    }(std::index_sequence_for<Ts...>{}),
+    "A type is registered twice");
+
+  static constexpr std::size_t size = sizeof...(Ts);
+
+  template<class T>
+  static constexpr bool contains = (std::is_same_v<T, Ts> || ...);
+
+  template<class T>
+    requires contains<T>
+  static constexpr std::size_t id = mpc::index_of_v<T, mpc::types<Ts...>>;
+
+  // table[id<T>] == f.template operator()<T>()
+  template<class V, class F>
+  static constexpr std::array<V, size> make_table(F f) {
+    return {f.template operator()<Ts>()...};
+  }
+};
+
+template<class Domain, class T>
+  requires Domain::template contains<T>
+inline constexpr std::size_t type_id_v = Domain::template id<T>;
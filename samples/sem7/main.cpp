@@ -9,23 +9,61 @@
 #include <tuple>
 #include <memory>
 #include <ranges>
+#include <functional>
+#include <string>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "object_pool.hpp"
+#include "tuple.hpp"
 
 
 template<class T>
 struct Tag {};
 
-template<class Interface>
+// How a factory allocates what it creates
+struct HeapAllocation {
+  template<class Interface>
+  using Pointer = std::unique_ptr<Interface>;
+
+  template<class Implementation, class Interface>
+  static Pointer<Interface> make() {
+    return std::make_unique<Implementation>();
+  }
+};
+
+// Recycles the objects, see object_pool.hpp
+struct PooledAllocation {
+  template<class Interface>
+  using Pointer = PooledPtr<Interface>;
+
+  template<class Implementation, class Interface>
+  static Pointer<Interface> make() {
+    return make_pooled<Implementation, Interface>();
+  }
+};
+
+template<class Interface, class Allocation>
 struct CreatorInterface {
-  virtual std::unique_ptr<Interface> create(Tag<Interface>) = 0;
+  virtual typename Allocation::template Pointer<Interface> create(Tag<Interface>) = 0;
 };
 
-template<class... Interfaces>
-struct AbstractFactory : private CreatorInterface<Interfaces>... {
-  using CreatorInterface<Interfaces>::create...;
+template<class Allocation_, class... Interfaces>
+struct BasicAbstractFactory : private CreatorInterface<Interfaces, Allocation_>... {
+  using Allocation = Allocation_;
+  using CreatorInterface<Interfaces, Allocation>::create...;
 
-  virtual ~AbstractFactory() = default;
+  virtual ~BasicAbstractFactory() = default;
 };
 
+template<class... Interfaces>
+using AbstractFactory = BasicAbstractFactory<HeapAllocation, Interfaces...>;
+
+template<class... Interfaces>
+using PooledAbstractFactory = BasicAbstractFactory<PooledAllocation, Interfaces...>;
+
 struct Cat { virtual ~Cat() = default; };
 struct Dog { virtual ~Dog() = default; };
 struct Cow { virtual ~Cow() = default; };
@@ -55,26 +93,32 @@ struct ConcreteCreator
     , TypeTuple<Interfaces...>
     , FinalParent
     > {
-  std::unique_ptr<Interface> create(Tag<Interface>) override {
-    return std::make_unique<Implementation>();
+  using Allocation = typename FinalParent::Allocation;
+
+  typename Allocation::template Pointer<Interface> create(Tag<Interface>) override {
+    return Allocation::template make<Implementation, Interface>();
   }
 };
 
-template<class Interfaces, class Implementations>
+template<class Interfaces, class Implementations, class Allocation = HeapAllocation>
 struct ConcreteFactory;
 
-template<class... Interfaces, class... Implementations>
+template<class... Interfaces, class... Implementations, class Allocation>
 struct ConcreteFactory
   < TypeTuple<Interfaces...>
   , TypeTuple<Implementations...>
+  , Allocation
   >
   : ConcreteCreator
     < TypeTuple<Implementations...>
     , TypeTuple<Interfaces...>
-    , AbstractFactory<Interfaces...>
+    , BasicAbstractFactory<Allocation, Interfaces...>
     > {
 };
 
+template<class Interfaces, class Implementations>
+using PooledConcreteFactory = ConcreteFactory<Interfaces, Implementations, PooledAllocation>;
+
 
 template<size_t I>
 struct ValueTag {};
@@ -102,7 +146,7 @@ struct Tuple1<std::index_sequence<Is...>, Ts...>
 };
 
 template<class... Ts>
-using Tuple = Tuple1<std::make_index_sequence<sizeof...(Ts)>, Ts...>;
+using FlatTuple = Tuple1<std::make_index_sequence<sizeof...(Ts)>, Ts...>;
 
 
 
@@ -114,7 +158,7 @@ struct Tuple2<T, Ts...> : private Tuple2<Ts...> {
   template<size_t I>
   auto& get() {
     if constexpr (I == 0) return t;
-    else return Tuple<Ts...>::template get<I - 1>();
+    else return Tuple2<Ts...>::template get<I - 1>();
   }
 
   T t;
@@ -131,6 +175,32 @@ decltype(auto) get(Tuple&& t) {
 }
 
 
+// Every thread creates and drops animals, a few of them alive at a time
+template<class Factory>
+void bench_factory(const char* name, Factory& factory) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 1'000'000;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&factory] {
+      for (int i = 0; i < kIterations; ++i) {
+        auto cat = factory.create(Tag<Cat>{});
+        auto dog = factory.create(Tag<Dog>{});
+        auto cow = factory.create(Tag<Cow>{});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << name << ": " << 3.0 * kThreads * kIterations / elapsed.count() / 1e6
+            << " M creates/s" << std::endl;
+}
+
 int main() {
   std::unique_ptr<AbstractFactory<Cat, Dog, Cow>> factory =
     std::make_unique<
@@ -143,11 +213,50 @@ int main() {
   auto cat = factory->create(Tag<Cat>{});
   std::cout << typeid(*cat).name() << std::endl;
 
-  Tuple<int, int, float> tuple{};
+  std::unique_ptr<PooledAbstractFactory<Cat, Dog, Cow>> pooled =
+    std::make_unique<
+      PooledConcreteFactory
+      < TypeTuple<Cat, Dog, Cow>
+      , TypeTuple<Sphinx, Spaniel, BlackAngus>
+      >
+    >();
+
+  Cow* first = nullptr;
+  {
+    auto cow = pooled->create(Tag<Cow>{});
+    std::cout << typeid(*cow).name() << std::endl;
+    first = cow.get();
+  }
+  // The same memory again
+  std::cout << std::boolalpha << (pooled->create(Tag<Cow>{}).get() == first) << std::endl;
+
+  bench_factory("make_unique", *factory);
+  bench_factory("pooled", *pooled);
+
+  FlatTuple<int, int, float> flat{};
+
+  get<float>(flat) = 4;
+
+  std::cout << get<2>(flat) << std::endl;
+
+  Tuple2<char, int, float> recursive{};
+  recursive.get<2>() = 5;
+
+  std::cout << recursive.get<2>() << std::endl;
+
+  // Stored as double, int, char, char: no padding between the chars
+  Tuple<char, double, char, int> tuple{'a', 1.5, 'b', 42};
+  static_assert(sizeof(tuple) == 16);
+  static_assert(sizeof(std::tuple<char, double, char, int>) == 24);
 
-  get<float>(tuple) = 4;
+  auto& [c1, d, c2, i] = tuple;
+  i += 1;
+  std::cout << c1 << ' ' << d << ' ' << c2 << ' ' << get<int>(tuple) << std::endl;
 
-  std::cout << get<2>(tuple) << std::endl;
+  // Empty elements take no space
+  Tuple<std::less<>, std::string, std::equal_to<>> with_empty{std::less<>{}, "empty", std::equal_to<>{}};
+  static_assert(sizeof(with_empty) == sizeof(std::string));
+  std::cout << get<1>(std::move(with_empty)) << std::endl;
 
   return 0;
 }
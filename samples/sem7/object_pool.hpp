@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+// ObjectPool<T> recycles the memory of destroyed Ts instead of returning
+// it to the allocator. Each thread keeps a cache of free slots and only
+// takes the shared list's mutex to move a batch of them in or out, so in
+// a steady state create and destroy are a few pointer operations.
+//
+// Slots are never given back to the allocator while the program runs.
+template<class T>
+class ObjectPool {
+  union Slot {
+    Slot* next;
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+  static constexpr std::size_t kBatchSize = 32;
+  // A thread's cache gives kBatchSize slots away when it grows beyond this
+  static constexpr std::size_t kCacheLimit = 2 * kBatchSize;
+
+  struct Shared {
+    ~Shared() {
+      while (head != nullptr) {
+        delete std::exchange(head, head->next);
+      }
+    }
+
+    std::mutex mutex;
+    Slot* head = nullptr;
+  };
+
+  struct Cache {
+    ~Cache() {
+      if (head != nullptr) {
+        try_give_back(size);
+      }
+    }
+
+    Slot* pop() noexcept {
+      --size;
+      return std::exchange(head, head->next);
+    }
+
+    void push(Slot* slot) noexcept {
+      slot->next = head;
+      head = slot;
+      ++size;
+    }
+
+    // Locks before touching the cache, so if locking throws the cache is
+    // left as it was
+    void give_back(std::size_t count) {
+      std::lock_guard guard(shared().mutex);
+
+      Slot* first = head;
+      Slot* last = head;
+      for (std::size_t i = 1; i < count; ++i) {
+        last = last->next;
+      }
+      head = last->next;
+      size -= count;
+
+      last->next = shared().head;
+      shared().head = first;
+    }
+
+    // For destroy and the destructor, which must not throw: if the mutex
+    // cannot be locked the slots stay in this cache, to be given back on
+    // a later destroy, or to leak when the thread exits
+    void try_give_back(std::size_t count) noexcept {
+      try {
+        give_back(count);
+      } catch (...) {
+      }
+    }
+
+    void take_batch() {
+      std::lock_guard guard(shared().mutex);
+      while (size < kBatchSize && shared().head != nullptr) {
+        push(std::exchange(shared().head, shared().head->next));
+      }
+    }
+
+    Slot* head = nullptr;
+    std::size_t size = 0;
+  };
+
+public:
+  template<class... Args>
+  static T* create(Args&&... args) {
+    Cache& c = cache();
+    if (c.head == nullptr) {
+      c.take_batch();
+    }
+    Slot* slot = c.head != nullptr ? c.pop() : new Slot;
+
+    try {
+      return ::new (slot->storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+      c.push(slot);
+      throw;
+    }
+  }
+
+  static void destroy(T* object) noexcept {
+    object->~T();
+    // storage is the first member of the slot
+    Slot* slot = reinterpret_cast<Slot*>(object);
+
+    Cache& c = cache();
+    c.push(slot);
+    if (c.size > kCacheLimit) {
+      c.try_give_back(kBatchSize);
+    }
+  }
+
+private:
+  static Shared& shared() {
+    static Shared instance;
+    return instance;
+  }
+
+  static Cache& cache() {
+    thread_local Cache instance;
+    return instance;
+  }
+};
+
+// Returns the object to the pool of its dynamic type
+template<class Interface>
+struct PoolDeleter {
+  void (*release)(Interface*) noexcept = nullptr;
+
+  void operator()(Interface* object) const noexcept {
+    release(object);
+  }
+};
+
+template<class Interface>
+using PooledPtr = std::unique_ptr<Interface, PoolDeleter<Interface>>;
+
+template<class Implementation, class Interface = Implementation, class... Args>
+PooledPtr<Interface> make_pooled(Args&&... args) {
+  auto release = [](Interface* object) noexcept {
+    ObjectPool<Implementation>::destroy(static_cast<Implementation*>(object));
+  };
+  return PooledPtr<Interface>(
+    ObjectPool<Implementation>::create(std::forward<Args>(args)...),
+    PoolDeleter<Interface>{release});
+}
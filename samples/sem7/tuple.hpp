@@ -0,0 +1,187 @@
+#pragma once
+
+#include <lib/indexing.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Tuple<Ts...> is the flat Tuple1: every element is a base of its own, so
+// get<I> is one cast and the instantiation depth does not grow with the
+// number of elements (std::tuple is recursive in the common standard
+// libraries).
+//
+// Elements are laid out by decreasing alignment to keep the padding
+// small, get<I> still means the I-th of Ts. Empty non-final elements are
+// inherited from instead of being stored, so they take no space.
+//
+// Supports structured bindings.
+
+namespace tuple_detail {
+
+template<std::size_t I, class T, bool = std::is_empty_v<T> && !std::is_final_v<T>>
+struct TupleLeaf {
+  constexpr TupleLeaf() : value() {}
+
+  template<class U>
+  constexpr explicit TupleLeaf(std::in_place_t, U&& u) : value(std::forward<U>(u)) {}
+
+  constexpr T& get() noexcept { return value; }
+  constexpr const T& get() const noexcept { return value; }
+
+  T value;
+};
+
+template<std::size_t I, class T>
+struct TupleLeaf<I, T, true> : private T {
+  constexpr TupleLeaf() : T() {}
+
+  template<class U>
+  constexpr explicit TupleLeaf(std::in_place_t, U&& u) : T(std::forward<U>(u)) {}
+
+  constexpr T& get() noexcept { return *this; }
+  constexpr const T& get() const noexcept { return *this; }
+};
+
+// Original indices in the order of the storage
+template<class... Ts>
+constexpr std::array<std::size_t, sizeof...(Ts)> storage_order() {
+  std::array<std::size_t, sizeof...(Ts)> order{};
+  constexpr std::array<std::size_t, sizeof...(Ts)> alignments{alignof(Ts)...};
+  // Insertion sort: stable and constexpr, unlike std::stable_sort
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    std::size_t j = i;
+    for (; j > 0 && alignments[order[j - 1]] < alignments[i]; --j) {
+      order[j] = order[j - 1];
+    }
+    order[j] = i;
+  }
+  return order;
+}
+
+template<std::size_t>
+struct IgnoreArg {
+  constexpr IgnoreArg(const auto&) {}
+};
+
+// Picks the argument number sizeof...(Js) without recursion
+template<class Indices>
+struct ArgPicker;
+
+template<std::size_t... Js>
+struct ArgPicker<std::index_sequence<Js...>> {
+  template<class T>
+  static constexpr T&& pick(IgnoreArg<Js>..., T&& arg, const auto&...) {
+    return std::forward<T>(arg);
+  }
+};
+
+template<std::size_t I, class... Args>
+constexpr decltype(auto) pick_arg(Args&&... args) {
+  return ArgPicker<std::make_index_sequence<I>>::pick(std::forward<Args>(args)...);
+}
+
+template<class Order, class... Ts>
+struct TupleStorage;
+
+template<std::size_t... Os, class... Ts>
+struct TupleStorage<std::index_sequence<Os...>, Ts...>
+  : TupleLeaf<Os, mpc::type_at_t<Os, mpc::types<Ts...>>>... {
+  constexpr TupleStorage() = default;
+
+  template<class... Us>
+  constexpr explicit TupleStorage(std::in_place_t, Us&&... us)
+    : TupleLeaf<Os, mpc::type_at_t<Os, mpc::types<Ts...>>>(std::in_place, pick_arg<Os>(std::forward<Us>(us)...))... {
+  }
+};
+
+template<class Ks, class... Ts>
+struct StorageFor;
+
+template<std::size_t... Ks, class... Ts>
+struct StorageFor<std::index_sequence<Ks...>, Ts...> {
+  static constexpr auto order = storage_order<Ts...>();
+  using type = TupleStorage<std::index_sequence<order[Ks]...>, Ts...>;
+};
+
+template<class... Ts>
+using storage_t = typename StorageFor<std::make_index_sequence<sizeof...(Ts)>, Ts...>::type;
+
+} // namespace tuple_detail
+
+template<class... Ts>
+class Tuple : private tuple_detail::storage_t<Ts...> {
+  using Storage = tuple_detail::storage_t<Ts...>;
+
+  template<std::size_t I>
+  using Element = mpc::type_at_t<I, mpc::types<Ts...>>;
+
+  template<std::size_t I>
+  using Leaf = tuple_detail::TupleLeaf<I, Element<I>>;
+
+  template<class T>
+  static constexpr std::size_t kCount = (std::size_t{std::is_same_v<T, Ts>} + ... + 0);
+
+public:
+  constexpr Tuple() requires (std::default_initializable<Ts> && ...) = default;
+
+  template<class... Us>
+    requires (sizeof...(Us) == sizeof...(Ts) && sizeof...(Ts) > 0
+      && !(sizeof...(Us) == 1 && (std::same_as<std::remove_cvref_t<Us>, Tuple> && ...))
+      && (std::constructible_from<Ts, Us&&> && ...))
+  constexpr Tuple(Us&&... us)
+    : Storage(std::in_place, std::forward<Us>(us)...) {
+  }
+
+  template<std::size_t I>
+    requires (I < sizeof...(Ts))
+  friend constexpr auto& get(Tuple& t) noexcept {
+    return static_cast<Leaf<I>&>(t).get();
+  }
+
+  template<std::size_t I>
+    requires (I < sizeof...(Ts))
+  friend constexpr const auto& get(const Tuple& t) noexcept {
+    return static_cast<const Leaf<I>&>(t).get();
+  }
+
+  template<std::size_t I>
+    requires (I < sizeof...(Ts))
+  friend constexpr Element<I>&& get(Tuple&& t) noexcept {
+    return static_cast<Element<I>&&>(static_cast<Leaf<I>&>(t).get());
+  }
+
+  // Only for a T occurring once in Ts
+  template<class T>
+    requires (kCount<T> == 1)
+  friend constexpr T& get(Tuple& t) noexcept {
+    return get<mpc::index_of_v<T, mpc::types<Ts...>>>(t);
+  }
+
+  template<class T>
+    requires (kCount<T> == 1)
+  friend constexpr const T& get(const Tuple& t) noexcept {
+    return get<mpc::index_of_v<T, mpc::types<Ts...>>>(t);
+  }
+
+  template<class T>
+    requires (kCount<T> == 1)
+  friend constexpr T&& get(Tuple&& t) noexcept {
+    return get<mpc::index_of_v<T, mpc::types<Ts...>>>(std::move(t));
+  }
+};
+
+template<class... Ts>
+Tuple(Ts...) -> Tuple<Ts...>;
+
+template<class... Ts>
+struct std::tuple_size<Tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {
+};
+
+template<std::size_t I, class... Ts>
+struct std::tuple_element<I, Tuple<Ts...>> {
+  using type = mpc::type_at_t<I, mpc::types<Ts...>>;
+};
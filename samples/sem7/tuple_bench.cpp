@@ -0,0 +1,75 @@
+// Compile time and sizeof of Tuple against std::tuple. Build one target
+// at a time to compare, e.g.
+//
+//   time cmake --build . --target tuple_bench_mpc_512
+//   time cmake --build . --target tuple_bench_std_512
+//
+// TUPLE_BENCH_SIZE is the number of elements, TUPLE_BENCH_STD picks
+// std::tuple.
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "tuple.hpp"
+
+#ifndef TUPLE_BENCH_SIZE
+#define TUPLE_BENCH_SIZE 16
+#endif
+
+#ifdef TUPLE_BENCH_STD
+template<class... Ts>
+using BenchTuple = std::tuple<Ts...>;
+inline constexpr const char* kName = "std::tuple";
+#else
+template<class... Ts>
+using BenchTuple = Tuple<Ts...>;
+inline constexpr const char* kName = "Tuple";
+#endif
+
+template<std::size_t I>
+struct Empty {};
+
+// Mixed alignments and empty types
+template<std::size_t I>
+using Element =
+  std::conditional_t<I % 4 == 0, char,
+  std::conditional_t<I % 4 == 1, double,
+  std::conditional_t<I % 4 == 2, std::int16_t,
+  Empty<I>>>>;
+
+template<class T>
+double touch(T& value, std::size_t i) {
+  if constexpr (std::is_empty_v<T>) {
+    return 0;
+  } else {
+    value = static_cast<T>(i % 100);
+    return value;
+  }
+}
+
+template<class Indices>
+struct Bench;
+
+template<std::size_t... Is>
+struct Bench<std::index_sequence<Is...>> {
+  using Type = BenchTuple<Element<Is>...>;
+
+  // Instantiates get for every element
+  static double run() {
+    using std::get;
+    Type t{};
+    return (0.0 + ... + touch(get<Is>(t), Is));
+  }
+};
+
+using Tested = Bench<std::make_index_sequence<TUPLE_BENCH_SIZE>>;
+
+int main() {
+  std::cout << kName << " of " << TUPLE_BENCH_SIZE << " elements: "
+            << sizeof(Tested::Type) << " bytes, checksum " << Tested::run() << std::endl;
+  return 0;
+}
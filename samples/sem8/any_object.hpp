@@ -1,19 +1,140 @@
 #pragma once
 
+#include "tag_invoke.hpp"
+
+#include <lib/vtable.hpp>
+
 #include <concepts>
-#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
-template <typename T>
-concept DependentFalse = false;
+// any_object<inlineVtable, CPOs...> (basic_any_object with a custom buffer)
+// erases a copyable value behind a set of CPOs. Copy and destruction are
+// entries of the same table as the CPOs (see lib/vtable.hpp): with
+// inlineVtable the whole table is inside the object, otherwise the object
+// keeps one pointer to a static table shared by all objects holding the
+// same type.
+//
+// The small buffer is a policy, see small_buffer. It only keeps trivially
+// relocatable values (is_trivially_relocatable), everything else goes to
+// the heap, so moving an any_object is a memcpy and never a call through
+// the table; std::vector<any_object> reallocates with plain copies.
+//
+// CPOs must not be called on an empty any_object.
+//
+// An any_object converts to one with a subset of its CPOs in O(1) by
+// copying the needed entries, so the target needs an inline table.
+
+// Size and alignment of the buffer values are stored in, more strictly
+// aligned values go to the heap. Room for at least a pointer is needed for
+// the values that go to the heap.
+template <std::size_t Size, std::size_t Alignment = alignof(void*)>
+struct small_buffer {
+  static_assert(Size >= sizeof(void*));
+  static_assert(Alignment >= alignof(void*));
+
+  static constexpr std::size_t size = Size;
+  static constexpr std::size_t alignment = Alignment;
+};
+
+// 32 bytes per object with the static table pointer
+using default_small_buffer = small_buffer<24>;
 
-inline constexpr std::size_t SMALL_BUFFER_SIZE = 40;
-inline constexpr std::size_t ALIGNMENT = 64;
+// What this_ turns into in the erased signatures
+template <class Buffer>
+struct basic_object {
+  void* data() {
+    return storage_;
+  }
+
+  const void* data() const {
+    return storage_;
+  }
 
-union Object {
-  void* dynObject_;
-  alignas(ALIGNMENT) std::array<std::byte, SMALL_BUFFER_SIZE> staticObject_;
+  alignas(Buffer::alignment) std::byte storage_[Buffer::size];
+};
+
+using Object = basic_object<default_small_buffer>;
+
+template <class T>
+inline constexpr bool is_object_v = false;
+
+template <class Buffer>
+inline constexpr bool is_object_v<basic_object<Buffer>> = true;
+
+// Whether a T can be moved to another address by copying its bytes (and
+// not destroying the source). Specialize for the types you know to be.
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {
+};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Keeps a value that does not fit the buffer on the heap, while being
+// pointer-sized and nothrow movable itself
+template <class T>
+class heap_box {
+public:
+  template <class U>
+  explicit heap_box(std::in_place_t, U&& value)
+    : object_(new T(std::forward<U>(value))) {
+  }
+
+  heap_box(const heap_box& other)
+    : object_(new T(*other.object_)) {
+  }
+
+  heap_box(heap_box&& other) noexcept
+    : object_(std::exchange(other.object_, nullptr)) {
+  }
+
+  heap_box& operator=(const heap_box&) = delete;
+  heap_box& operator=(heap_box&&) = delete;
+
+  ~heap_box() {
+    delete object_;
+  }
+
+  T& get() const noexcept {
+    return *object_;
+  }
+
+private:
+  T* object_;
+};
+
+template <class T>
+struct is_trivially_relocatable<heap_box<T>> : std::true_type {
+};
+
+// The only check telling whether a value is kept in the buffer
+template <class T, class Buffer>
+inline constexpr bool fits_small_buffer =
+  sizeof(T) <= Buffer::size
+  && alignof(T) <= Buffer::alignment
+  && is_trivially_relocatable_v<T>;
+
+// What is actually placed into the buffer for a value of type T
+template <class T, class Buffer>
+using stored_t = std::conditional_t<fits_small_buffer<T, Buffer>, T, heap_box<T>>;
+
+template <class Stored>
+struct Unbox {
+  static Stored& get(Stored& stored) {
+    return stored;
+  }
+};
+
+template <class T>
+struct Unbox<heap_box<T>> {
+  static T& get(const heap_box<T>& box) {
+    return box.get();
+  }
 };
 
 
@@ -52,288 +173,248 @@ struct ReplaceThisImpl<From, To, T(Us...)> {
     typename ReplaceOne<From, To, Us>::type...);
 };
 
-template<class CPO, class Signature>
-struct TagInvocableImpl;
-
-template<class CPO, class T, class... Us>
-struct TagInvocableImpl<CPO, T(Us...)> {
-  static constexpr bool value = mpc::tag_invocable<CPO, Us...>;
+// mpc::overload<Signature>(cpo) only fixes the erased signature, the
+// concrete types implement the underlying CPO
+template<class CPO>
+struct BaseCpo {
+  using type = CPO;
 };
 
-template<class CPO, class T, class SigErased>
-struct DoTagInvoke;
-
-template<class CPO, class T, class RetErased, class... ArgsErased>
-struct DoTagInvoke<CPO, T, RetErased(ArgsErased...)> {
-  static auto make_tag_invoke() {
-    static constexpr auto prepare_arg = [](auto&& arg) -> decltype(auto) {
-      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(arg)>, Object>) {
-        using Tptr = std::conditional_t<
-          std::is_const_v<std::remove_reference_t<decltype(arg)>>,
-          const T*, T*>;
-        if constexpr (sizeof(T) < SMALL_BUFFER_SIZE)
-          return *std::launder(reinterpret_cast<Tptr>(arg.staticObject_.data()));
-        else
-          return *static_cast<Tptr>(arg.dynObject_);
-      }
-      else {
-        return std::forward<decltype(arg)>(arg);
-      }
-    };
-    return +[](ArgsErased... args) -> RetErased {
-      static_assert(!std::is_same_v<std::remove_cvref_t<RetErased>, Object>);
-      return mpc::tag_invoke(CPO{}, prepare_arg(std::forward<ArgsErased>(args))...);
-    };
-  }
+template<class Signature, class CPO>
+struct BaseCpo<mpc::OverloadedCpo<Signature, CPO>> {
+  using type = CPO;
 };
 
+template<class CPO, class... CPOs>
+struct FindCpo;
 
-
-template<class CPO>
-struct vtable_entry
-{
-  using ModifiedSignature = typename ReplaceThisImpl<mpc::this_, Object, typename CPO::type_erased_signature_t>::Type;
-  // DONE: replace this_ with Object&
-  ModifiedSignature* fptr = nullptr;
-
-  template<class T>
-  //  requires mpc::tag_invocable<CPO, ..., T, ...>
-    // requires TagInvocableImpl<CPO, ModifiedSignature>::value
-  static vtable_entry create()
-  {
-    return vtable_entry{
-      .fptr = DoTagInvoke<CPO, T, ModifiedSignature>::make_tag_invoke()
-    };
-  };
-
-
-  void setImpl(CPO, ModifiedSignature f) {
-    fptr = f;
-  }
-  auto getImpl(CPO) const {
-    return fptr;
-  }
+template<class CPO, class First, class... Rest>
+struct FindCpo<CPO, First, Rest...>
+  : std::conditional_t<
+      std::same_as<CPO, typename BaseCpo<First>::type>,
+      std::type_identity<First>,
+      FindCpo<CPO, Rest...>> {
 };
 
-template<class... CPOs>
-struct vtable : vtable_entry<CPOs>...
-{
-  using vtable_entry<CPOs>::getImpl...;
-  using vtable_entry<CPOs>::setImpl...;
+template<class CPO, class Stored, class SigErased>
+struct DoTagInvoke;
 
-  template<class CPO>
-  auto get() const
-  {
-    return getImpl(CPO{});
+template<class CPO, class Stored, class RetErased, class... ArgsErased>
+struct DoTagInvoke<CPO, Stored, RetErased(ArgsErased...)> {
+  static_assert(!is_object_v<std::remove_cvref_t<RetErased>>);
+
+  template<class Arg>
+  static decltype(auto) prepare_arg(Arg&& arg) {
+    if constexpr (is_object_v<std::remove_cvref_t<Arg>>) {
+      auto& value = Unbox<Stored>::get(*std::launder(static_cast<Stored*>(const_cast<void*>(arg.data()))));
+      using Value = std::remove_reference_t<decltype(value)>;
+      if constexpr (std::is_rvalue_reference_v<Arg&&>) {
+        return std::move(value);
+      } else if constexpr (std::is_const_v<std::remove_reference_t<Arg>>) {
+        return static_cast<const Value&>(value);
+      } else {
+        return (value);
+      }
+    } else {
+      return std::forward<Arg>(arg);
+    }
   }
 
-  template<class T>
-  static vtable create()
-  {
-    vtable object;
-    ((object.setImpl(CPOs{}, vtable_entry<CPOs>::template create<T>().fptr)), ...);
-    return object;
-  };
+  static RetErased call(ArgsErased... args) {
+    return mpc::tag_invoke(typename BaseCpo<CPO>::type{}, prepare_arg(std::forward<ArgsErased>(args))...);
+  }
 };
 
-template<class... CPOs>
-struct inline_vtable_storage : vtable<CPOs...> {
-  inline_vtable_storage() = default;
+// The vtable entry of a CPO in terms of lib/vtable.hpp
+template<class CPO, class Buffer,
+  class ModifiedSignature = typename ReplaceThisImpl<mpc::this_, basic_object<Buffer>, typename CPO::type_erased_signature_t>::Type>
+struct cpo_entry;
 
-  template<class T>
-  inline_vtable_storage(const T&)
-    : vtable<CPOs...>{vtable<CPOs...>::template create<T>()} {
-  }
-
-  using vtable<CPOs...>::get;
-};
+template<class CPO, class Buffer, class R, class... Args>
+struct cpo_entry<CPO, Buffer, R(Args...)> {
+  using Signature = R(Args...);
 
-template <class T, class... CPOs>
-struct class_specific_vtable_storage
-{
-  static vtable<CPOs...> * get_vtable() {
-    static vtable<CPOs...> static_vtable = vtable<CPOs...>::create();
-    return &static_vtable;
+  template<class Stored>
+  static R invoke(Args... args) {
+    return DoTagInvoke<CPO, Stored, Signature>::call(std::forward<Args>(args)...);
   }
 };
 
-template <class... CPOs>
-struct indirect_vtable_storage
-{
+// Moves are memcpy, so no relocate entry
+using any_object_lifetime = mpc::entry_list<mpc::destroy_entry, mpc::copy_entry>;
 
-  template <class T>
-  indirect_vtable_storage(const T&)
-    : vt(class_specific_vtable_storage<T>::get_vtable()) {
-  }
+template<class Buffer, bool inlineVtable, class... CPOs>
+using any_object_vtable_t = mpc::vtable_storage_t<
+  std::conditional_t<inlineVtable, mpc::inline_vtable_policy, mpc::static_vtable_policy>,
+  any_object_lifetime,
+  mpc::entry_list<cpo_entry<CPOs, Buffer>...>>;
 
-  indirect_vtable_storage() = default;
+template<class Buffer, bool inlineVtable, class... CPOs>
+class basic_any_object;
 
-  template <class CPO>
-  auto get() const {
-    return vt->template get<CPO>();
-  }
+template<bool inlineVtable, class... CPOs>
+using any_object = basic_any_object<default_small_buffer, inlineVtable, CPOs...>;
 
-  vtable<CPOs...> *vt = nullptr; // ptr to **static** storage
-};
+template<class Buffer, bool inlineVtable, class... CPOs>
+void as_any_object(const basic_any_object<Buffer, inlineVtable, CPOs...>&);
 
-template<bool inlineVtable, class... CPOs>
-class any_object
+template<class T>
+concept AnyObject = requires(const T& t) { as_any_object(t); };
+
+template<class Buffer, bool inlineVtable, class... CPOs>
+class basic_any_object
 {
-  using vtable_t = vtable<CPOs...>;
+  using vtable_t = any_object_vtable_t<Buffer, inlineVtable, CPOs...>;
+  using Object = basic_object<Buffer>;
+
+  template<class, bool, class...>
+  friend class basic_any_object;
+
 public:
-  any_object() = default;
+  basic_any_object() = default;
 
   template<class T>
-    requires (!std::derived_from<std::decay_t<T>, any_object>
-      && !std::same_as<std::decay_t<T>, any_object>
+    requires (!AnyObject<std::remove_cvref_t<T>>
       && std::copyable<std::remove_cvref_t<T>>)
-  any_object(T&& t)
-    : vt_{t} {
+  basic_any_object(T&& t) {
     using Value = std::remove_cvref_t<T>;
+    using Stored = stored_t<Value, Buffer>;
 
-    static_assert(alignof(Value) <= ALIGNMENT);
-
-    if constexpr (sizeof(Value) <= SMALL_BUFFER_SIZE)
-      new(object_.staticObject_.data()) Value(std::forward<T>(t));
+    if constexpr (std::same_as<Stored, Value>)
+      ::new (object_.data()) Value(std::forward<T>(t));
     else
-      object_.dynObject_ = new Value(std::forward<T>(t));
+      ::new (object_.data()) Stored(std::in_place, std::forward<T>(t));
 
-    destructor_ = &destroy<Value>;
-    copy_ = &copy<Value>;
-    move_ = &move<Value>;
+    vt_ = vtable_t::template make<Stored>();
   }
 
-  any_object(any_object&& other) {
-    move_(object_, other.object_);
-    destructor_ = other.destructor_;
-    copy_ = other.copy_;
-    move_ = other.move_;
-    vt_ = other.vt_;
+  // Cross-cast to a (non-strict) subset of CPOs
+  template<bool otherInline, class... OtherCPOs>
+    requires (inlineVtable
+      && !std::same_as<basic_any_object<Buffer, otherInline, OtherCPOs...>, basic_any_object>
+      && (mpc::detail::one_of<CPOs, OtherCPOs...> && ...))
+  basic_any_object(const basic_any_object<Buffer, otherInline, OtherCPOs...>& other) {
+    if (!other.vt_.empty()) {
+      other.vt_.template call<mpc::copy_entry>(object_.data(), other.object_.data());
+      vt_ = vtable_t::subset_of(other.vt_);
+    }
   }
 
-  any_object& operator=(any_object&& other) {
+  template<bool otherInline, class... OtherCPOs>
+    requires (inlineVtable
+      && !std::same_as<basic_any_object<Buffer, otherInline, OtherCPOs...>, basic_any_object>
+      && (mpc::detail::one_of<CPOs, OtherCPOs...> && ...))
+  basic_any_object(basic_any_object<Buffer, otherInline, OtherCPOs...>&& other) noexcept {
+    if (!other.vt_.empty()) {
+      std::memcpy(object_.data(), other.object_.data(), Buffer::size);
+      vt_ = vtable_t::subset_of(other.vt_);
+      other.vt_ = {};
+    }
+  }
+
+  basic_any_object(basic_any_object&& other) noexcept {
+    steal(other);
+  }
+
+  basic_any_object& operator=(basic_any_object&& other) noexcept {
     if (this != &other) {
       clear();
-
-      move_(object_, other.object_);
-      destructor_ = std::exchange(other.destructor_, nullptr);
-      copy_ = std::exchange(other.copy_, nullptr);
-      move_ = std::exchange(other.move_, nullptr);
-      vt_ = std::exchange(other.vt_, decltype(other.vt_){});
+      steal(other);
     }
 
     return *this;
   }
 
-  any_object(const any_object& other) {
-    destructor_ = other.destructor_;
-    copy_ = other.copy_;
-    vt_ = other.vt_;
-    copy_(object_, other.object_);
+  basic_any_object(const basic_any_object& other) {
+    if (!other.vt_.empty()) {
+      other.vt_.template call<mpc::copy_entry>(object_.data(), other.object_.data());
+      vt_ = other.vt_;
+    }
   }
 
-  any_object& operator=(const any_object& other) {
+  basic_any_object& operator=(const basic_any_object& other) {
     if (this != &other) {
+      basic_any_object copy(other);
       clear();
-      destructor_ = other.destructor_;
-      copy_ = other.copy_;
-      vt_ = other.vt_;
-      copy_(object_, other.object_);
+      steal(copy);
     }
     return *this;
   }
 
-  ~any_object() {
+  ~basic_any_object() {
     clear();
   }
 
-  void clear() {
-    if (destructor_)
+  void clear() noexcept {
+    if (!vt_.empty())
     {
-      destructor_(object_);
-      copy_ = nullptr;
-      destructor_ = nullptr;
-      move_ = nullptr;
+      vt_.template call<mpc::destroy_entry>(object_.data());
       vt_ = {};
     }
   }
 
+  bool empty() const noexcept {
+    return vt_.empty();
+  }
+
 private:
   template<class T>
-  friend T& any_cast(any_object& a) {
-    if (a.destructor_ == &any_object::destroy<T>)
-    {
-      if constexpr (sizeof(T) <= SMALL_BUFFER_SIZE)
-        return *std::launder(reinterpret_cast<T*>(a.object_.staticObject_.data()));
-      else
-        return *static_cast<T*>(&a.object_.dynObject_);
-    }
+  friend T& any_cast(basic_any_object& a) {
+    using Stored = stored_t<T, Buffer>;
+    if (a.vt_.template holds<Stored>())
+      return Unbox<Stored>::get(*std::launder(static_cast<Stored*>(a.object_.data())));
     else
       throw std::runtime_error("Bad any_object cast!");
   }
 
   template<class T>
-  static void destroy(Object& ptr)
-  {
-    if constexpr (sizeof(T) < SMALL_BUFFER_SIZE)
-      std::launder(reinterpret_cast<T*>(ptr.staticObject_.data()))->~T();
-    else
-      delete static_cast<T*>(ptr.dynObject_);
+  friend const T& any_cast(const basic_any_object& a) {
+    return any_cast<T>(const_cast<basic_any_object&>(a));
   }
 
-  template<class T>
-  static void copy(Object& to, const Object& from)
-  {
-    if constexpr (sizeof(T) < SMALL_BUFFER_SIZE)
-      new(to.staticObject_.data()) T(
-        *std::launder(reinterpret_cast<const T*>(from.staticObject_.data())));
-    else
-      to.dynObject_ = new T(*static_cast<T*>(from.dynObject_));
+  void steal(basic_any_object& other) noexcept {
+    if (!other.vt_.empty()) {
+      std::memcpy(object_.data(), other.object_.data(), Buffer::size);
+      vt_ = std::exchange(other.vt_, vtable_t{});
+    }
   }
 
-  template<class T>
-  static void move(Object& to, Object& from)
-  {
-    if constexpr (sizeof(T) < SMALL_BUFFER_SIZE)
-    {
-      auto* object = std::launder(reinterpret_cast<T*>(from.staticObject_.data()));
-      new(to.staticObject_.data()) T(std::move(*object));
-      object->~T();
-      from.dynObject_ = nullptr;
+  template<class Arg>
+  static constexpr bool is_self = std::derived_from<std::remove_cvref_t<Arg>, basic_any_object>;
+
+  // Turns the any_object arguments (or derived, like shapes::any_shape)
+  // into the Object the erased signature expects
+  template<class Arg>
+  static decltype(auto) erase_arg(Arg&& arg) {
+    if constexpr (!is_self<Arg>) {
+      return std::forward<Arg>(arg);
+    } else if constexpr (std::is_rvalue_reference_v<Arg&&>) {
+      return std::move(static_cast<basic_any_object&>(arg).object_);
+    } else if constexpr (std::is_const_v<std::remove_reference_t<Arg>>) {
+      return static_cast<const Object&>(static_cast<const basic_any_object&>(arg).object_);
+    } else {
+      return static_cast<Object&>(static_cast<basic_any_object&>(arg).object_);
     }
-    else
-      to.dynObject_ = std::exchange(from.dynObject_, nullptr);
   }
 
-  // TODO: tag_invoke(CPOs)...
-
-  operator Object& () { return object_; }
-  operator const Object& () const { return object_; }
-
-  template <typename CPO, typename... Args>
-  friend decltype(auto) tag_invoke(CPO, Args&&... args)
-    requires requires(std::tuple<CPOs...> t) { std::get<CPO>(t); } {
-    (([&]<class T>(T&& arg) mutable {
-      if constexpr (std::derived_from<std::decay_t<T>, any_object>) {
-        auto func = arg.vt_.template get<CPO>();
-        // static_assert(DependentFalse<decltype(&func)>);
-        func(std::forward<Args>(args)...);
+  template<typename CPO, typename... Args>
+    requires ((std::same_as<CPO, typename BaseCpo<CPOs>::type> || ...)
+      && (is_self<Args> || ...))
+  friend decltype(auto) tag_invoke(CPO, Args&&... args) {
+    using Entry = cpo_entry<typename FindCpo<CPO, CPOs...>::type, Buffer>;
+
+    const basic_any_object* self = nullptr;
+    ([&] {
+      if constexpr (is_self<Args>) {
+        if (self == nullptr)
+          self = &static_cast<const basic_any_object&>(args);
       }
-    }(args)), ...);
-  }
+    }(), ...);
 
-  // TODO: cross-cast to any_object with a (non-strict) subset of CPOs?
+    return self->vt_.template call<Entry>(erase_arg(std::forward<Args>(args))...);
+  }
 
 private:
-  Object object_{nullptr};
-
-  // TODO: replace with something CPO-ish?
-  void(*copy_)(Object&, const Object&) {nullptr};
-  void(*move_)(Object&, Object&) {nullptr};
-  void(*destructor_)(Object&) {nullptr};
-
-  // TODO: store and use CPO vtable
-  std::conditional_t<inlineVtable,
-    inline_vtable_storage<CPOs...>, indirect_vtable_storage<CPOs...>>
-    vt_;
+  Object object_;
+  vtable_t vt_;
 };
@@ -1,18 +1,223 @@
 #include "tag_invoke.hpp"
 #include "any_object.hpp"
 #include "shapes.hpp"
+#include "poly_collection.hpp"
 
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 
+void test_dispatch() {
+  shapes::square sq(42);
+
+  shapes::any_shape1 s{sq};
+  assert(shapes::area(s) == 42.0f * 42.0f);
+  assert(shapes::width(s) == 42.0f);
+
+  shapes::any_shape1_indirect r{shapes::rectangle(2, 3)};
+  assert(shapes::area(r) == 6.0f);
+  assert(shapes::height(r) == 3.0f);
+
+  // One pointer to a static table instead of a pointer per entry and the
+  // type tag
+  static_assert(sizeof(shapes::any_shape1_indirect) == 32);
+  static_assert(sizeof(shapes::any_shape1) == 24 + 6 * sizeof(void*));
+
+  shapes::any_shape shape{sq};
+  shapes::any_shape scaled = shapes::scale_by(shape, 2);
+  assert(shapes::width(scaled) == 84.0f);
+  assert(any_cast<shapes::square>(scaled).size == 84.0f);
+  static_assert(shapes::shape<shapes::any_shape>);
+
+  // Cross-cast to fewer CPOs keeps the value
+  shapes::any_shape1 narrow = scaled;
+  assert(shapes::area(narrow) == 84.0f * 84.0f);
+  assert(any_cast<shapes::square>(narrow).size == 84.0f);
+
+  shapes::any_shape1 copy = narrow;
+  shapes::any_shape1 moved = std::move(narrow);
+  assert(narrow.empty());
+  assert(shapes::area(copy) == shapes::area(moved));
+
+  copy = r;
+  assert(shapes::area(copy) == 6.0f);
+
+  // Not trivially relocatable, so on the heap, but still works
+  struct named_square : shapes::square {
+    using shapes::square::square;
+    std::string name = "named";
+  };
+  static_assert(!fits_small_buffer<named_square, default_small_buffer>);
+  shapes::any_shape1 named{named_square(3)};
+  shapes::any_shape1 named_copy = named;
+  std::vector<shapes::any_shape1> many(100, named);
+  many.emplace_back(shapes::square(1));
+  assert(shapes::area(named_copy) == 9.0f && shapes::area(many[50]) == 9.0f);
+  assert(any_cast<named_square>(many[99]).name == "named");
+
+  [[maybe_unused]] bool thrown = false;
+  try {
+    any_cast<shapes::rectangle>(s);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+using shape_collection = poly_collection<mpc::tag_t<shapes::area>, mpc::tag_t<shapes::width>>;
+
+void test_poly_collection() {
+  shape_collection c;
+  assert(c.empty());
+
+  c.insert(shapes::square(2));
+  c.insert(shapes::rectangle(1, 3));
+  c.emplace<shapes::square>(3);
+  assert(c.size() == 3);
+  assert(c.segment_of<shapes::square>().size() == 2);
+  assert(c.segment_of<shapes::rectangle>()[0].h == 3);
+
+  // Grouped by type: squares first, they came first
+  std::vector<float> areas;
+  c.for_each(shapes::area, [&](float a) { areas.push_back(a); });
+  assert((areas == std::vector<float>{4, 9, 3}));
+
+  shape_collection copy = c;
+  c.clear();
+  float width = 0;
+  copy.for_each(shapes::width, [&](float w) { width += w; });
+  assert(width == 6 && c.empty() && copy.size() == 3);
+}
+
+
+namespace virtual_shapes {
 
+struct shape {
+  virtual ~shape() = default;
+  virtual float area() const = 0;
+};
+
+struct square : shape {
+  explicit square(float size) : size(size) {}
+  float area() const override { return size * size; }
+  float size;
+};
+
+struct rectangle : shape {
+  rectangle(float w, float h) : w(w), h(h) {}
+  float area() const override { return w * h; }
+  float w;
+  float h;
+};
+
+} // namespace virtual_shapes
+
+template <class F>
+double measure(F&& f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+template <class AnyShape>
+double bench_any(const char* name, std::size_t count) {
+  std::vector<AnyShape> shapes;
+  shapes.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i % 2 == 0)
+      shapes.emplace_back(shapes::square(i % 7));
+    else
+      shapes.emplace_back(shapes::rectangle(i % 5, 2));
+  }
+
+  float total = 0;
+  double ms = measure([&] {
+    for (const auto& s : shapes)
+      total += shapes::area(s);
+  });
+  std::cout << name << ": " << ms << " ms (" << sizeof(AnyShape) << " bytes each), total " << total << std::endl;
+  return total;
+}
+
+double bench_poly_collection(std::size_t count) {
+  shape_collection shapes;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i % 2 == 0)
+      shapes.insert(shapes::square(i % 7));
+    else
+      shapes.insert(shapes::rectangle(i % 5, 2));
+  }
+
+  float total = 0;
+  double ms = measure([&] {
+    shapes.for_each(shapes::area, [&](float a) { total += a; });
+  });
+  std::cout << "poly_collection: " << ms << " ms, total " << total << std::endl;
+  return total;
+}
+
+double bench_virtual(std::size_t count) {
+  std::vector<std::unique_ptr<virtual_shapes::shape>> shapes;
+  shapes.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i % 2 == 0)
+      shapes.push_back(std::make_unique<virtual_shapes::square>(i % 7));
+    else
+      shapes.push_back(std::make_unique<virtual_shapes::rectangle>(i % 5, 2));
+  }
+
+  float total = 0;
+  double ms = measure([&] {
+    for (const auto& s : shapes)
+      total += s->area();
+  });
+  std::cout << "virtual: " << ms << " ms, total " << total << std::endl;
+  return total;
+}
+
+template <class Buffer>
+using buffered_shape = basic_any_object<
+  Buffer,
+  false,
+  mpc::tag_t<shapes::width>,
+  mpc::tag_t<shapes::height>,
+  mpc::tag_t<shapes::area>>;
+
+// Reallocations only memcpy the objects
+template <class AnyShape>
+void bench_growth(const char* name, std::size_t count) {
+  std::vector<AnyShape> shapes;
+  double ms = measure([&] {
+    for (std::size_t i = 0; i < count; ++i)
+      shapes.emplace_back(shapes::rectangle(i % 5, 2));
+  });
+  std::cout << name << ": " << sizeof(AnyShape) << " bytes per object, "
+            << count << " push_backs in " << ms << " ms" << std::endl;
+}
 
 int main() {
-  shapes::square sq(42);
+  test_dispatch();
+  test_poly_collection();
 
-  shapes::any_shape1 s{sq};
+  constexpr std::size_t kCount = 1'000'000;
+  [[maybe_unused]] double inline_total = bench_any<shapes::any_shape1>("any_shape1", kCount);
+  [[maybe_unused]] double indirect_total = bench_any<shapes::any_shape1_indirect>("any_shape1_indirect", kCount);
+  [[maybe_unused]] double virtual_total = bench_virtual(kCount);
+  [[maybe_unused]] double poly_total = bench_poly_collection(kCount);
+  assert(inline_total == virtual_total && indirect_total == virtual_total);
+  // Summed in a different order
+  assert(std::abs(poly_total - virtual_total) <= 1e-3 * virtual_total);
 
-  shapes::area(s);
-  // auto s2 = shapes::scale_by(s, 2);
+  bench_growth<buffered_shape<small_buffer<16>>>("small_buffer<16>", kCount);
+  bench_growth<buffered_shape<small_buffer<24>>>("small_buffer<24>", kCount);
+  bench_growth<buffered_shape<small_buffer<56>>>("small_buffer<56>", kCount);
+  bench_growth<buffered_shape<small_buffer<56, 64>>>("small_buffer<56, 64>", kCount);
 
   return 0;
 }
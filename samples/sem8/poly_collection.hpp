@@ -0,0 +1,221 @@
+#pragma once
+
+#include "tag_invoke.hpp"
+
+#include <lib/vtable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// poly_collection<CPOs...> holds values of any types implementing the CPOs
+// (unary ones, with a float(const mpc::this_&)-like erased signature),
+// each type in its own contiguous std::vector. for_each(cpo, f) goes
+// segment by segment: one call through the segment's table evaluates the
+// CPO over a whole chunk of elements in a loop over concrete values, then
+// f runs over the results. Elements are visited grouped by type, in the
+// order the types first appeared, not in insertion order.
+
+namespace poly_detail {
+
+template<class Signature>
+struct UnaryCpoResult;
+
+template<class R>
+struct UnaryCpoResult<R(const mpc::this_&)> {
+  using type = R;
+};
+
+template<class CPO>
+using cpo_result_t = typename UnaryCpoResult<typename CPO::type_erased_signature_t>::type;
+
+inline constexpr std::size_t kChunkSize = 256;
+
+// Each segment is a heap-allocated std::vector<T>
+
+struct delete_entry {
+  using Signature = void(void* segment) noexcept;
+
+  template<class T>
+  static void invoke(void* segment) noexcept {
+    delete static_cast<std::vector<T>*>(segment);
+  }
+};
+
+struct clone_entry {
+  using Signature = void*(const void* segment);
+
+  template<class T>
+  static void* invoke(const void* segment) {
+    return new std::vector<T>(*static_cast<const std::vector<T>*>(segment));
+  }
+};
+
+struct size_entry {
+  using Signature = std::size_t(const void* segment) noexcept;
+
+  template<class T>
+  static std::size_t invoke(const void* segment) noexcept {
+    return static_cast<const std::vector<T>*>(segment)->size();
+  }
+};
+
+// Writes cpo(segment[from + i]) to out[i] for i < count
+template<class CPO>
+struct evaluate_entry {
+  using R = cpo_result_t<CPO>;
+  using Signature = void(const void* segment, std::size_t from, std::size_t count, R* out);
+
+  template<class T>
+  static void invoke(const void* segment, std::size_t from, std::size_t count, R* out) {
+    const T* values = static_cast<const std::vector<T>*>(segment)->data() + from;
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = mpc::tag_invoke(CPO{}, values[i]);
+    }
+  }
+};
+
+} // namespace poly_detail
+
+template<class... CPOs>
+class poly_collection {
+  using table_t = mpc::static_vtable<
+    poly_detail::delete_entry,
+    poly_detail::clone_entry,
+    poly_detail::size_entry,
+    poly_detail::evaluate_entry<CPOs>...>;
+
+  struct segment {
+    table_t table;
+    void* values;
+  };
+
+public:
+  template<class T>
+  static constexpr bool accepts = std::copyable<T> && (mpc::tag_invocable<CPOs, const T&> && ...);
+
+  poly_collection() = default;
+
+  poly_collection(const poly_collection& other) {
+    segments_.reserve(other.segments_.size());
+    try {
+      for (const segment& s : other.segments_) {
+        segments_.push_back({s.table, s.table.template call<poly_detail::clone_entry>(s.values)});
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  poly_collection(poly_collection&& other) noexcept
+    : segments_(std::move(other.segments_)) {
+    other.segments_.clear();
+  }
+
+  poly_collection& operator=(const poly_collection& other) {
+    if (this != &other) {
+      poly_collection copy(other);
+      std::swap(segments_, copy.segments_);
+    }
+    return *this;
+  }
+
+  poly_collection& operator=(poly_collection&& other) noexcept {
+    if (this != &other) {
+      clear();
+      std::swap(segments_, other.segments_);
+    }
+    return *this;
+  }
+
+  ~poly_collection() {
+    clear();
+  }
+
+  template<class T>
+    requires accepts<std::remove_cvref_t<T>>
+  void insert(T&& value) {
+    values_of<std::remove_cvref_t<T>>().push_back(std::forward<T>(value));
+  }
+
+  template<class T, class... Args>
+    requires accepts<T> && std::constructible_from<T, Args...>
+  T& emplace(Args&&... args) {
+    return values_of<T>().emplace_back(std::forward<Args>(args)...);
+  }
+
+  std::size_t size() const noexcept {
+    std::size_t result = 0;
+    for (const segment& s : segments_) {
+      result += s.table.template call<poly_detail::size_entry>(s.values);
+    }
+    return result;
+  }
+
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  void clear() noexcept {
+    for (const segment& s : segments_) {
+      s.table.template call<poly_detail::delete_entry>(s.values);
+    }
+    segments_.clear();
+  }
+
+  // The values of type T, empty if there are none
+  template<class T>
+  std::span<const T> segment_of() const {
+    if (const segment* s = find<T>()) {
+      return *static_cast<const std::vector<T>*>(s->values);
+    }
+    return {};
+  }
+
+  // Calls f(cpo(x)) for every x
+  template<class CPO, class F>
+    requires mpc::detail::one_of<CPO, CPOs...>
+  void for_each(CPO, F&& f) const {
+    using R = poly_detail::cpo_result_t<CPO>;
+
+    std::array<R, poly_detail::kChunkSize> results;
+    for (const segment& s : segments_) {
+      const std::size_t size = s.table.template call<poly_detail::size_entry>(s.values);
+      for (std::size_t from = 0; from < size; from += results.size()) {
+        const std::size_t count = std::min(results.size(), size - from);
+        s.table.template call<poly_detail::evaluate_entry<CPO>>(s.values, from, count, results.data());
+        for (std::size_t i = 0; i < count; ++i) {
+          f(results[i]);
+        }
+      }
+    }
+  }
+
+private:
+  template<class T>
+  const segment* find() const {
+    auto it = std::find_if(segments_.begin(), segments_.end(), [](const segment& s) {
+      return s.table.template holds<T>();
+    });
+    return it == segments_.end() ? nullptr : &*it;
+  }
+
+  template<class T>
+  std::vector<T>& values_of() {
+    if (const segment* s = find<T>()) {
+      return *static_cast<std::vector<T>*>(s->values);
+    }
+    segments_.reserve(segments_.size() + 1);
+    auto* values = new std::vector<T>();
+    segments_.push_back({table_t::template make<T>(), values});
+    return *values;
+  }
+
+  std::vector<segment> segments_;
+};
@@ -1,7 +1,6 @@
 #pragma once
 #include "tag_invoke.hpp"
-
-#include <iostream>
+#include "any_object.hpp"
 
 namespace shapes
 {
@@ -70,22 +69,50 @@ namespace shapes
     }
 
     friend float tag_invoke(mpc::tag_t<shapes::area>, const square& s) {
-      std::cout << "area";
       return s.size * s.size;
     }
 
     friend square tag_invoke(mpc::tag_t<shapes::scale_by>, const square& s, float ratio) {
-      std::cout << "scale_by";
       return square{s.size * ratio};
     }
   };
 
+  struct rectangle {
+    float w;
+    float h;
+  public:
+    rectangle(float w, float h) : w(w), h(h) {}
+
+    friend float tag_invoke(mpc::tag_t<shapes::width>, const rectangle& r) {
+      return r.w;
+    }
+
+    friend float tag_invoke(mpc::tag_t<shapes::height>, const rectangle& r) {
+      return r.h;
+    }
+
+    friend float tag_invoke(mpc::tag_t<shapes::area>, const rectangle& r) {
+      return r.w * r.h;
+    }
+
+    friend rectangle tag_invoke(mpc::tag_t<shapes::scale_by>, const rectangle& r, float ratio) {
+      return rectangle{r.w * ratio, r.h * ratio};
+    }
+  };
+
   using any_shape1 = any_object<
     true,
     mpc::tag_t<shapes::width>,
     mpc::tag_t<shapes::height>,
     mpc::tag_t<shapes::area>>;
 
+  // Same, but with a single pointer to a static vtable
+  using any_shape1_indirect = any_object<
+    false,
+    mpc::tag_t<shapes::width>,
+    mpc::tag_t<shapes::height>,
+    mpc::tag_t<shapes::area>>;
+
   // square sq;
   // any_shape1 a = sq;
   // shapes::width(a); -> width(sq)
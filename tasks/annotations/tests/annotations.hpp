@@ -21,6 +21,12 @@ struct C;
 template <class... Adaptors>
 struct Adapt;
 
+template <class Algorithm>
+struct Checksum;
+
+template <class Key>
+struct Group;
+
 template <std::size_t n>
 using SizeT = std::integral_constant<std::size_t, n>;
 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <reflect.hpp>
+#include "annotations.hpp"
+
+#include <cstdint>
+
+
+#define MAKE_FIELD_NAME(c) MPC_CONCAT(field, c)
+
+#define MAKE_FIELD \
+MPC_ANNOTATE(SerialId<SizeT<4>>, SerialId<SizeT<5>>, SerialId<SizeT<6>>) int MAKE_FIELD_NAME(__COUNTER__);
+
+#define MAKE_2 MAKE_FIELD MAKE_FIELD
+#define MAKE_4 MAKE_2 MAKE_2
+#define MAKE_8 MAKE_4 MAKE_4
+#define MAKE_16 MAKE_8 MAKE_8
+#define MAKE_32 MAKE_16 MAKE_16
+#define MAKE_64 MAKE_32 MAKE_32
+#define MAKE_128 MAKE_64 MAKE_64
+#define MAKE_256 MAKE_128 MAKE_128
+
+// Fields without annotations, for tests and benchmarks of long structures
+#define MAKE_PLAIN_FIELD std::uint16_t MAKE_FIELD_NAME(__COUNTER__);
+
+#define MAKE_PLAIN_2 MAKE_PLAIN_FIELD MAKE_PLAIN_FIELD
+#define MAKE_PLAIN_4 MAKE_PLAIN_2 MAKE_PLAIN_2
+#define MAKE_PLAIN_8 MAKE_PLAIN_4 MAKE_PLAIN_4
+#define MAKE_PLAIN_16 MAKE_PLAIN_8 MAKE_PLAIN_8
+#define MAKE_PLAIN_32 MAKE_PLAIN_16 MAKE_PLAIN_16
+#define MAKE_PLAIN_64 MAKE_PLAIN_32 MAKE_PLAIN_32
+#define MAKE_PLAIN_128 MAKE_PLAIN_64 MAKE_PLAIN_64
+#define MAKE_PLAIN_256 MAKE_PLAIN_128 MAKE_PLAIN_128
+#define MAKE_PLAIN_512 MAKE_PLAIN_256 MAKE_PLAIN_256
+#define MAKE_PLAIN_1024 MAKE_PLAIN_512 MAKE_PLAIN_512
+#define MAKE_PLAIN_2048 MAKE_PLAIN_1024 MAKE_PLAIN_1024
+#define MAKE_PLAIN_4096 MAKE_PLAIN_2048 MAKE_PLAIN_2048
+
+namespace mpc::annotations {
+
+// 256 annotated int fields
+struct Chonk {
+  MAKE_256
+};
+
+}
@@ -0,0 +1,229 @@
+#include <reflect.hpp>
+#include <type_traits>
+#include "annotations.hpp"
+#include "chonk.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <utility>
+
+
+using namespace mpc::annotations;
+
+struct Sum8 {
+  static std::uint8_t compute(std::span<const std::byte> bytes) noexcept {
+    std::uint8_t sum = 0;
+    for (std::byte b : bytes) {
+      sum += static_cast<std::uint8_t>(b);
+    }
+    return sum;
+  }
+};
+
+struct Crc32 {
+  static std::uint32_t compute(std::span<const std::byte> bytes) noexcept {
+    std::uint32_t crc = 0xFFFFFFFF;
+    for (std::byte b : bytes) {
+      crc ^= static_cast<std::uint8_t>(b);
+      for (int i = 0; i < 8; ++i) {
+        crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+      }
+    }
+    return ~crc;
+  }
+};
+
+template <class T>
+using Codec = BinaryCodec<T, Annotate<NoIo, Transient>, Checksum>;
+
+template <class T>
+std::array<std::byte, sizeof(T)> bytesOf(const T& value) {
+  std::array<std::byte, sizeof(T)> result;
+  std::memcpy(result.data(), &value, sizeof(T));
+  return result;
+}
+
+
+struct Header {
+  std::uint8_t kind;
+  std::uint32_t length;
+};
+
+struct Packet {
+  Header header;
+
+  MPC_ANNOTATE(NoIo)
+  int cache;
+
+  std::uint16_t port;
+
+  MPC_ANNOTATE(Transient, NoCompare)
+  double weight;
+
+  float ratio;
+
+  MPC_ANNOTATE(Checksum<Crc32>)
+  std::uint32_t crc;
+};
+
+// Field by field: designated initializers would have to name the
+// annotation members as well
+Packet makePacket(std::uint8_t kind, std::uint32_t length, int cache, std::uint16_t port, double weight, float ratio) {
+  Packet packet{};
+  packet.header = {kind, length};
+  packet.cache = cache;
+  packet.port = port;
+  packet.weight = weight;
+  packet.ratio = ratio;
+  return packet;
+}
+
+// Fields go back to back in declaration order, no padding, skipped ones take no space
+static_assert(Codec<Header>::size == 5);
+static_assert(Codec<Packet>::size == 5 + 2 + 4 + 4);
+
+struct Empty {};
+static_assert(Codec<Empty>::size == 0);
+
+static_assert(Codec<Chonk>::size == 256 * sizeof(int));
+
+static_assert(Describe<Packet>::num_fields == 6);
+static_assert(std::same_as<decltype(Describe<Packet>::get<2>(std::declval<Packet&>())), std::uint16_t&>);
+static_assert(std::same_as<decltype(Describe<Packet>::get<4>(std::declval<const Packet&>())), const float&>);
+
+
+TEST(CodecTest, Get)
+{
+  Packet packet{};
+  Describe<Packet>::get<2>(packet) = 8080;
+  Describe<Packet>::get<0>(packet).length = 42;
+  ASSERT_EQ(8080, packet.port);
+  ASSERT_EQ(42u, packet.header.length);
+  ASSERT_EQ(&packet.crc, &Describe<Packet>::get<5>(packet));
+}
+
+TEST(CodecTest, Layout)
+{
+  Packet packet = makePacket(7, 123456, 99, 443, 0.5, 1.25f);
+
+  std::array<std::byte, Codec<Packet>::size> buffer;
+  Codec<Packet>::encode(packet, buffer);
+
+  std::size_t offset = 0;
+  auto expect = [&](const auto& value) {
+    auto bytes = bytesOf(value);
+    ASSERT_EQ(0, std::memcmp(buffer.data() + offset, bytes.data(), bytes.size())) << "at offset " << offset;
+    offset += bytes.size();
+  };
+
+  expect(std::uint8_t{7});
+  expect(std::uint32_t{123456});
+  expect(std::uint16_t{443});
+  expect(1.25f);
+  // The stored checksum is ignored, the one over the preceding bytes is written
+  expect(Crc32::compute(std::span(buffer).first(offset)));
+  ASSERT_EQ(buffer.size(), offset);
+}
+
+TEST(CodecTest, RoundTrip)
+{
+  Packet packet = makePacket(1, 2, 3, 4, 5.0, 6.0f);
+
+  std::array<std::byte, Codec<Packet>::size> buffer;
+  Codec<Packet>::encode(packet, buffer);
+  std::optional<Packet> decoded = Codec<Packet>::decode(buffer);
+
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_EQ(1, decoded->header.kind);
+  ASSERT_EQ(2u, decoded->header.length);
+  ASSERT_EQ(4, decoded->port);
+  ASSERT_EQ(6.0f, decoded->ratio);
+  ASSERT_EQ(Crc32::compute(std::span(buffer).first(11)), decoded->crc);
+
+  // Skipped fields are value-initialized
+  ASSERT_EQ(0, decoded->cache);
+  ASSERT_EQ(0.0, decoded->weight);
+}
+
+TEST(CodecTest, Corruption)
+{
+  Packet packet = makePacket(1, 2, 3, 4, 5.0, 6.0f);
+
+  std::array<std::byte, Codec<Packet>::size> buffer;
+  Codec<Packet>::encode(packet, buffer);
+
+  for (std::size_t i = 0; i < buffer.size(); ++i) {
+    auto corrupted = buffer;
+    corrupted[i] ^= std::byte{0x10};
+    ASSERT_FALSE(Codec<Packet>::decode(corrupted).has_value()) << "byte " << i;
+  }
+}
+
+struct Nested {
+  MPC_ANNOTATE(Checksum<Sum8>)
+  std::uint8_t empty_sum;
+
+  std::uint8_t a;
+  std::uint8_t b;
+
+  MPC_ANNOTATE(Checksum<Sum8>)
+  std::uint8_t sum;
+};
+
+struct Outer {
+  std::uint8_t tag;
+  Nested inner;
+
+  MPC_ANNOTATE(Checksum<Sum8>)
+  std::uint8_t total;
+};
+
+TEST(CodecTest, NestedChecksums)
+{
+  static_assert(Codec<Outer>::size == 6);
+
+  Outer outer{};
+  outer.tag = 10;
+  outer.inner.a = 20;
+  outer.inner.b = 30;
+  std::array<std::byte, Codec<Outer>::size> buffer;
+  Codec<Outer>::encode(outer, buffer);
+
+  // A checksum covers the preceding bytes of its own struct
+  ASSERT_EQ(std::byte{0}, buffer[1]);
+  ASSERT_EQ(std::byte{50}, buffer[4]);
+  ASSERT_EQ(std::byte{10 + 20 + 30 + 50}, buffer[5]);
+
+  auto decoded = Codec<Outer>::decode(buffer);
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_EQ(50, decoded->inner.sum);
+
+  buffer[4] = std::byte{51};
+  ASSERT_FALSE(Codec<Outer>::decode(buffer).has_value());
+}
+
+TEST(CodecTest, Chonk)
+{
+  Chonk chonk{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((Describe<Chonk>::get<Is>(chonk) = static_cast<int>(Is * Is)), ...);
+  }(std::make_index_sequence<256>{});
+
+  std::array<std::byte, Codec<Chonk>::size> buffer;
+  Codec<Chonk>::encode(chonk, buffer);
+  ASSERT_EQ(0, std::memcmp(buffer.data() + 255 * sizeof(int), bytesOf(255 * 255).data(), sizeof(int)));
+
+  auto decoded = Codec<Chonk>::decode(buffer);
+  ASSERT_TRUE(decoded.has_value());
+  bool same = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return ((Describe<Chonk>::get<Is>(*decoded) == Describe<Chonk>::get<Is>(chonk)) && ...);
+  }(std::make_index_sequence<256>{});
+  ASSERT_TRUE(same);
+}
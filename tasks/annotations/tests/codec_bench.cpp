@@ -0,0 +1,161 @@
+#include <reflect.hpp>
+#include "annotations.hpp"
+#include "chonk.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Throughput of BinaryCodec on the 256 fields of Chonk and on a small
+// struct, against a plain memcpy of the objects and a hand-written encoder
+
+using namespace mpc::annotations;
+
+struct Sum8 {
+  static std::uint8_t compute(std::span<const std::byte> bytes) noexcept {
+    std::uint8_t sum = 0;
+    for (std::byte b : bytes) {
+      sum += static_cast<std::uint8_t>(b);
+    }
+    return sum;
+  }
+};
+
+template <class T>
+using Codec = BinaryCodec<T, Annotate<NoIo, Transient>, Checksum>;
+
+struct Small {
+  std::uint8_t kind;
+  std::uint32_t length;
+
+  MPC_ANNOTATE(NoIo)
+  int cache;
+
+  std::uint16_t port;
+  float ratio;
+};
+
+struct Framed {
+  std::uint8_t kind;
+  std::uint32_t length;
+  std::uint16_t port;
+  float ratio;
+
+  MPC_ANNOTATE(Checksum<Sum8>)
+  std::uint8_t sum;
+};
+
+constexpr std::size_t kObjects = 1 << 10;
+
+std::vector<Chonk> MakeChonks() {
+  std::vector<Chonk> chonks(kObjects);
+  for (std::size_t i = 0; i < kObjects; ++i) {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((Describe<Chonk>::get<Is>(chonks[i]) = static_cast<int>(i + Is)), ...);
+    }(std::make_index_sequence<256>{});
+  }
+  return chonks;
+}
+
+template <class T>
+std::vector<T> MakeSmall() {
+  std::vector<T> objects(kObjects);
+  for (std::size_t i = 0; i < kObjects; ++i) {
+    objects[i].kind = static_cast<std::uint8_t>(i);
+    objects[i].length = static_cast<std::uint32_t>(i * 3);
+    objects[i].port = static_cast<std::uint16_t>(i * 7);
+    objects[i].ratio = static_cast<float>(i) / 2;
+  }
+  return objects;
+}
+
+// All the objects back to back in one buffer
+template <class T>
+void Encode(const std::vector<T>& objects, std::vector<std::byte>& buffer) {
+  constexpr std::size_t size = Codec<T>::size;
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    Codec<T>::encode(objects[i], std::span<std::byte, size>(buffer.data() + i * size, size));
+  }
+}
+
+template <class T>
+void BM_Encode(benchmark::State& state, std::vector<T> objects) {
+  std::vector<std::byte> buffer(objects.size() * Codec<T>::size);
+  for (auto _ : state) {
+    Encode(objects, buffer);
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+template <class T>
+void BM_Decode(benchmark::State& state, std::vector<T> objects) {
+  constexpr std::size_t size = Codec<T>::size;
+  std::vector<std::byte> buffer(objects.size() * size);
+  Encode(objects, buffer);
+  for (auto _ : state) {
+    std::size_t decoded = 0;
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      std::optional<T> object = Codec<T>::decode(std::span<const std::byte, size>(buffer.data() + i * size, size));
+      benchmark::DoNotOptimize(object);
+      decoded += object.has_value();
+    }
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+// The upper bound: the whole object with its annotations and padding
+template <class T>
+void BM_Memcpy(benchmark::State& state, std::vector<T> objects) {
+  std::vector<std::byte> buffer(objects.size() * sizeof(T));
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      std::memcpy(buffer.data() + i * sizeof(T), &objects[i], sizeof(T));
+    }
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+// What we used to write for every wire struct
+void BM_HandWritten(benchmark::State& state, std::vector<Small> objects) {
+  constexpr std::size_t size = sizeof(Small::kind) + sizeof(Small::length) + sizeof(Small::port) + sizeof(Small::ratio);
+  std::vector<std::byte> buffer(objects.size() * size);
+  for (auto _ : state) {
+    std::byte* out = buffer.data();
+    for (const Small& object : objects) {
+      std::memcpy(out, &object.kind, sizeof(object.kind));
+      out += sizeof(object.kind);
+      std::memcpy(out, &object.length, sizeof(object.length));
+      out += sizeof(object.length);
+      std::memcpy(out, &object.port, sizeof(object.port));
+      out += sizeof(object.port);
+      std::memcpy(out, &object.ratio, sizeof(object.ratio));
+      out += sizeof(object.ratio);
+    }
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK_CAPTURE(BM_Encode, Chonk, MakeChonks());
+BENCHMARK_CAPTURE(BM_Decode, Chonk, MakeChonks());
+BENCHMARK_CAPTURE(BM_Memcpy, Chonk, MakeChonks());
+
+BENCHMARK_CAPTURE(BM_Encode, Small, MakeSmall<Small>());
+BENCHMARK_CAPTURE(BM_Decode, Small, MakeSmall<Small>());
+BENCHMARK_CAPTURE(BM_HandWritten, Small, MakeSmall<Small>());
+BENCHMARK_CAPTURE(BM_Memcpy, Small, MakeSmall<Small>());
+
+BENCHMARK_CAPTURE(BM_Encode, Framed, MakeSmall<Framed>());
+BENCHMARK_CAPTURE(BM_Decode, Framed, MakeSmall<Framed>());
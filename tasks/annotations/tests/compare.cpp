@@ -0,0 +1,158 @@
+#include <reflect.hpp>
+#include <type_traits>
+#include "annotations.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+
+using namespace mpc::annotations;
+
+template <class T>
+using Equal = ReflectEqual<T, Annotate<NoCompare>>;
+
+template <class T>
+using Hash = ReflectHash<T, Annotate<NoCompare>>;
+
+// Fills the padding with garbage before setting the fields
+template <class T>
+T* scribble(void* storage, unsigned char fill) {
+  std::memset(storage, fill, sizeof(T));
+  return new (storage) T;
+}
+
+
+struct Key {
+  std::uint32_t id;
+  std::uint16_t shard;
+
+  MPC_ANNOTATE(NoCompare)
+  std::uint64_t last_seen;
+
+  std::uint8_t kind;
+};
+
+// Field by field: designated initializers would have to name the
+// annotation members as well
+Key makeKey(std::uint32_t id, std::uint16_t shard, std::uint64_t last_seen, std::uint8_t kind) {
+  Key key{};
+  key.id = id;
+  key.shard = shard;
+  key.last_seen = last_seen;
+  key.kind = kind;
+  return key;
+}
+
+TEST(CompareTest, SkipsNoCompare)
+{
+  Key a = makeKey(1, 2, 3, 4);
+  Key b = makeKey(1, 2, 300, 4);
+  Key c = makeKey(1, 2, 3, 5);
+
+  ASSERT_TRUE(Equal<Key>{}(a, b));
+  ASSERT_EQ(Hash<Key>{}(a), Hash<Key>{}(b));
+  ASSERT_FALSE(Equal<Key>{}(a, c));
+  ASSERT_FALSE(Equal<Key>{}(b, c));
+}
+
+TEST(CompareTest, IgnoresPadding)
+{
+  alignas(Key) unsigned char first[sizeof(Key)];
+  alignas(Key) unsigned char second[sizeof(Key)];
+  Key* a = scribble<Key>(first, 0x00);
+  Key* b = scribble<Key>(second, 0xAB);
+  for (Key* key : {a, b}) {
+    key->id = 10;
+    key->shard = 20;
+    key->last_seen = 0;
+    key->kind = 30;
+  }
+
+  ASSERT_TRUE(Equal<Key>{}(*a, *b));
+  ASSERT_EQ(Hash<Key>{}(*a), Hash<Key>{}(*b));
+}
+
+struct Point {
+  double x;
+  double y;
+};
+
+TEST(CompareTest, FloatingPoint)
+{
+  // Not bitwise: zeros of both signs are equal, NaN is equal to nothing
+  Point zero{0.0, 1.0};
+  Point negative_zero{-0.0, 1.0};
+  ASSERT_TRUE(Equal<Point>{}(zero, negative_zero));
+  ASSERT_EQ(Hash<Point>{}(zero), Hash<Point>{}(negative_zero));
+
+  Point nan{std::numeric_limits<double>::quiet_NaN(), 1.0};
+  ASSERT_FALSE(Equal<Point>{}(nan, nan));
+}
+
+struct Inner {
+  char c;
+  MPC_ANNOTATE(NoCompare)
+  int scratch;
+};
+
+Inner makeInner(char c, int scratch) {
+  Inner inner{};
+  inner.c = c;
+  inner.scratch = scratch;
+  return inner;
+}
+
+struct Outer {
+  Inner inner;
+  Point point;
+  std::int64_t value;
+};
+
+TEST(CompareTest, Nested)
+{
+  Outer a{makeInner('a', 1), {1.0, 2.0}, 3};
+  Outer b{makeInner('a', 2), {1.0, 2.0}, 3};
+  Outer c{makeInner('b', 1), {1.0, 2.0}, 3};
+
+  ASSERT_TRUE(Equal<Outer>{}(a, b));
+  ASSERT_EQ(Hash<Outer>{}(a), Hash<Outer>{}(b));
+  ASSERT_FALSE(Equal<Outer>{}(a, c));
+}
+
+struct Empty {};
+
+TEST(CompareTest, Empty)
+{
+  ASSERT_TRUE(Equal<Empty>{}(Empty{}, Empty{}));
+  ASSERT_EQ(Hash<Empty>{}(Empty{}), Hash<Empty>{}(Empty{}));
+}
+
+TEST(CompareTest, UnorderedMap)
+{
+  std::unordered_map<Key, std::string, Hash<Key>, Equal<Key>> map;
+  for (std::uint32_t i = 0; i < 10000; ++i) {
+    map[makeKey(i, static_cast<std::uint16_t>(i % 7), i, 1)] = std::to_string(i);
+  }
+  ASSERT_EQ(10000u, map.size());
+
+  for (std::uint32_t i = 0; i < 10000; ++i) {
+    auto it = map.find(makeKey(i, static_cast<std::uint16_t>(i % 7), 0, 1));
+    ASSERT_NE(map.end(), it);
+    ASSERT_EQ(std::to_string(i), it->second);
+  }
+  ASSERT_EQ(map.end(), map.find(makeKey(1, 1, 1, 2)));
+
+  // Different keys should not collide all the time
+  std::size_t buckets_used = 0;
+  for (std::size_t b = 0; b < map.bucket_count(); ++b) {
+    buckets_used += map.bucket_size(b) > 0;
+  }
+  ASSERT_GT(buckets_used, map.size() / 4);
+}
@@ -0,0 +1,132 @@
+#include <reflect.hpp>
+#include "annotations.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// std::unordered_map keyed by annotated structs: ReflectHash and
+// ReflectEqual against the hash and the comparison written by hand, on a
+// key that is one padding-free block and on one that is not
+
+using namespace mpc::annotations;
+
+// Compared and hashed as one block of 16 bytes
+struct Flat {
+  std::uint32_t id;
+  std::uint32_t shard;
+  std::uint64_t version;
+};
+
+// A skipped field in the middle and padding at the end, field by field
+struct Key {
+  std::uint32_t id;
+  std::uint16_t shard;
+
+  MPC_ANNOTATE(NoCompare)
+  std::uint64_t last_seen;
+
+  std::uint8_t kind;
+};
+
+template <class T>
+using Equal = ReflectEqual<T, Annotate<NoCompare>>;
+
+template <class T>
+using Hash = ReflectHash<T, Annotate<NoCompare>>;
+
+inline std::size_t Combine(std::size_t seed, std::size_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+struct FlatHash {
+  std::size_t operator()(const Flat& key) const {
+    std::size_t seed = std::hash<std::uint32_t>{}(key.id);
+    seed = Combine(seed, std::hash<std::uint32_t>{}(key.shard));
+    return Combine(seed, std::hash<std::uint64_t>{}(key.version));
+  }
+};
+
+struct FlatEqual {
+  bool operator()(const Flat& a, const Flat& b) const {
+    return a.id == b.id && a.shard == b.shard && a.version == b.version;
+  }
+};
+
+struct KeyHash {
+  std::size_t operator()(const Key& key) const {
+    std::size_t seed = std::hash<std::uint32_t>{}(key.id);
+    seed = Combine(seed, std::hash<std::uint16_t>{}(key.shard));
+    return Combine(seed, std::hash<std::uint8_t>{}(key.kind));
+  }
+};
+
+struct KeyEqual {
+  bool operator()(const Key& a, const Key& b) const {
+    return a.id == b.id && a.shard == b.shard && a.kind == b.kind;
+  }
+};
+
+template <class T>
+std::vector<T> MakeKeys(std::size_t count) {
+  std::mt19937 generator(42);
+  std::vector<T> keys(count);
+  for (T& key : keys) {
+    key.id = static_cast<std::uint32_t>(generator());
+    key.shard = static_cast<decltype(key.shard)>(generator());
+    if constexpr (requires { key.version; }) {
+      key.version = generator();
+    } else {
+      key.last_seen = generator();
+      key.kind = static_cast<std::uint8_t>(generator());
+    }
+  }
+  return keys;
+}
+
+template <class T, class H, class E>
+void BM_Insert(benchmark::State& state) {
+  auto keys = MakeKeys<T>(state.range(0));
+  for (auto _ : state) {
+    std::unordered_map<T, int, H, E> map;
+    map.reserve(keys.size());
+    for (const T& key : keys) {
+      map.emplace(key, 0);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Half of the lookups miss
+template <class T, class H, class E>
+void BM_Find(benchmark::State& state) {
+  auto keys = MakeKeys<T>(2 * state.range(0));
+  std::unordered_map<T, int, H, E> map;
+  for (std::size_t i = 0; i < keys.size(); i += 2) {
+    map.emplace(keys[i], 1);
+  }
+  for (auto _ : state) {
+    int found = 0;
+    for (const T& key : keys) {
+      found += map.count(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(BM_Insert<Flat, Hash<Flat>, Equal<Flat>>)->Name("BM_Insert/Flat/Reflect")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Insert<Flat, FlatHash, FlatEqual>)->Name("BM_Insert/Flat/HandWritten")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Find<Flat, Hash<Flat>, Equal<Flat>>)->Name("BM_Find/Flat/Reflect")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Find<Flat, FlatHash, FlatEqual>)->Name("BM_Find/Flat/HandWritten")->Range(1 << 10, 1 << 16);
+
+BENCHMARK(BM_Insert<Key, Hash<Key>, Equal<Key>>)->Name("BM_Insert/Key/Reflect")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Insert<Key, KeyHash, KeyEqual>)->Name("BM_Insert/Key/HandWritten")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Find<Key, Hash<Key>, Equal<Key>>)->Name("BM_Find/Key/Reflect")->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Find<Key, KeyHash, KeyEqual>)->Name("BM_Find/Key/HandWritten")->Range(1 << 10, 1 << 16);
@@ -0,0 +1,26 @@
+#include <reflect.hpp>
+#include "annotations.hpp"
+#include "chonk.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+// Compile-time benchmark, see make_compile_bench: Describe of a structure
+// of FIELDS plain fields, FIELDS is a power of two up to 4096
+
+#ifndef FIELDS
+#define FIELDS 1024
+#endif
+
+// Not MPC_CONCAT: the fields use it and it does not expand inside itself
+#define BENCH_CONCAT(a, b) a##b
+#define MAKE_PLAIN(count) BENCH_CONCAT(MAKE_PLAIN_, count)
+
+using namespace mpc::annotations;
+
+struct Wide {
+  MAKE_PLAIN(FIELDS)
+};
+
+static_assert(Describe<Wide>::num_fields == FIELDS);
+static_assert(std::is_same_v<Describe<Wide>::Field<FIELDS - 1>::Type, std::uint16_t>);
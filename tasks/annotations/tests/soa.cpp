@@ -0,0 +1,154 @@
+#include <reflect.hpp>
+#include <type_traits>
+#include "annotations.hpp"
+
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+using namespace mpc::annotations;
+
+struct Particle {
+  float x;
+  float y;
+
+  MPC_ANNOTATE(Group<A>)
+  float vx;
+  MPC_ANNOTATE(Group<A>)
+  float vy;
+
+  std::uint32_t id;
+
+  MPC_ANNOTATE(Group<B>, NoCompare)
+  double mass;
+  MPC_ANNOTATE(Group<B>)
+  char tag;
+};
+
+using Particles = SoaVector<Particle, Group>;
+
+static_assert(std::same_as<decltype(std::declval<Particles&>().field<0>()), std::span<float>>);
+static_assert(std::same_as<decltype(std::declval<const Particles&>().field<4>()), std::span<const std::uint32_t>>);
+
+template <class V, std::size_t I>
+concept HasField = requires (V& v) { v.template field<I>(); };
+
+// Grouped fields are not contiguous
+static_assert(HasField<Particles, 1>);
+static_assert(!HasField<Particles, 2>);
+static_assert(!HasField<Particles, 6>);
+
+
+Particle makeParticle(std::uint32_t i) {
+  Particle p{};
+  p.x = static_cast<float>(i);
+  p.y = 2.0f * i;
+  p.vx = 0.5f;
+  p.vy = -0.5f;
+  p.id = i;
+  p.mass = 10.0 + i;
+  p.tag = static_cast<char>('a' + i % 26);
+  return p;
+}
+
+TEST(SoaTest, PushAndRead)
+{
+  Particles particles;
+  ASSERT_TRUE(particles.empty());
+
+  for (std::uint32_t i = 0; i < 1000; ++i) {
+    particles.push_back(makeParticle(i));
+  }
+  ASSERT_EQ(1000u, particles.size());
+
+  for (std::uint32_t i = 0; i < 1000; ++i) {
+    Particle p = particles[i];
+    Particle expected = makeParticle(i);
+    ASSERT_EQ(expected.x, p.x);
+    ASSERT_EQ(expected.vy, p.vy);
+    ASSERT_EQ(expected.id, p.id);
+    ASSERT_EQ(expected.mass, p.mass);
+    ASSERT_EQ(expected.tag, p.tag);
+  }
+}
+
+TEST(SoaTest, Proxy)
+{
+  Particles particles;
+  particles.push_back(makeParticle(1));
+  particles.push_back(makeParticle(2));
+
+  auto ref = particles[1];
+  ref.get<0>() = 100.0f;
+  ref.get<5>() += 1.0;
+  ASSERT_EQ(100.0f, particles.field<0>()[1]);
+  ASSERT_EQ(13.0, static_cast<Particle>(particles[1]).mass);
+
+  particles[0] = makeParticle(7);
+  ASSERT_EQ(7u, particles.field<4>()[0]);
+  ASSERT_EQ('h', static_cast<Particle>(particles[0]).tag);
+
+  const Particles& view = particles;
+  static_assert(std::same_as<decltype(view[0].get<3>()), const float&>);
+  ASSERT_EQ(-0.5f, view[0].get<3>());
+}
+
+TEST(SoaTest, Kernels)
+{
+  Particles particles;
+  for (std::uint32_t i = 0; i < 4096; ++i) {
+    particles.push_back(makeParticle(i));
+  }
+
+  // A two-field update touching only the arrays it needs
+  std::span<float> x = particles.field<0>();
+  std::span<const float> y = std::as_const(particles).field<1>();
+  ASSERT_EQ(particles.size(), x.size());
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    x[i] += y[i];
+  }
+
+  for (std::uint32_t i = 0; i < 4096; ++i) {
+    ASSERT_EQ(3.0f * i, static_cast<Particle>(particles[i]).x);
+  }
+}
+
+TEST(SoaTest, Resize)
+{
+  Particles particles;
+  particles.reserve(10);
+  particles.resize(5);
+  ASSERT_EQ(5u, particles.size());
+  ASSERT_EQ(0u, particles.field<4>()[4]);
+
+  particles.push_back(makeParticle(3));
+  particles.pop_back();
+  particles.resize(2);
+  ASSERT_EQ(2u, particles.field<1>().size());
+
+  particles.clear();
+  ASSERT_TRUE(particles.empty());
+}
+
+TEST(SoaTest, Copy)
+{
+  Particles particles;
+  for (std::uint32_t i = 0; i < 10; ++i) {
+    particles.push_back(makeParticle(i));
+  }
+
+  Particles copy = particles;
+  copy.field<0>()[0] = 42.0f;
+  ASSERT_EQ(0.0f, particles.field<0>()[0]);
+  ASSERT_EQ(42.0f, copy.field<0>()[0]);
+
+  Particles moved = std::move(copy);
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(42.0f, moved.field<0>()[0]);
+}
@@ -0,0 +1,95 @@
+#include <reflect.hpp>
+#include "annotations.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A loop touching two fields of a ten-field struct: through std::vector<T>
+// it drags all of them through the cache, through SoaVector only the two
+
+using namespace mpc::annotations;
+
+struct Body {
+  float x;
+  float vx;
+
+  float y;
+  float z;
+  float vy;
+  float vz;
+
+  MPC_ANNOTATE(Group<A>)
+  double mass;
+  MPC_ANNOTATE(Group<A>)
+  double charge;
+
+  std::uint32_t id;
+  std::uint32_t flags;
+};
+
+using Bodies = SoaVector<Body, Group>;
+
+constexpr float kStep = 0.01f;
+
+Body MakeBody(std::size_t i) {
+  Body body{};
+  body.x = static_cast<float>(i);
+  body.vx = 1.0f / static_cast<float>(i + 1);
+  body.id = static_cast<std::uint32_t>(i);
+  return body;
+}
+
+void BM_Vector(benchmark::State& state) {
+  std::vector<Body> bodies;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    bodies.push_back(MakeBody(i));
+  }
+  for (auto _ : state) {
+    for (Body& body : bodies) {
+      body.x += body.vx * kStep;
+    }
+    benchmark::DoNotOptimize(bodies.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Vector)->Range(1 << 10, 1 << 20);
+
+void BM_SoaFields(benchmark::State& state) {
+  Bodies bodies;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    bodies.push_back(MakeBody(i));
+  }
+  for (auto _ : state) {
+    auto x = bodies.field<0>();
+    auto vx = bodies.field<1>();
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      x[i] += vx[i] * kStep;
+    }
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SoaFields)->Range(1 << 10, 1 << 20);
+
+// The same through the proxies, as code written for std::vector<T> would
+void BM_SoaProxies(benchmark::State& state) {
+  Bodies bodies;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    bodies.push_back(MakeBody(i));
+  }
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      auto body = bodies[i];
+      body.get<0>() += body.get<1>() * kStep;
+    }
+    benchmark::DoNotOptimize(&bodies);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SoaProxies)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,57 @@
+#include <reflect.hpp>
+#include <type_traits>
+#include "annotations.hpp"
+#include "chonk.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+
+// Must compile without flags raising template depth or constexpr limits
+
+using namespace mpc::annotations;
+
+struct Hundred {
+  MAKE_PLAIN_64
+  MAKE_PLAIN_32
+  MAKE_PLAIN_4
+};
+
+static_assert(Describe<Hundred>::num_fields == 100);
+static_assert(std::is_same_v<Describe<Hundred>::Field<99>::Type, std::uint16_t>);
+
+struct Thousand {
+  MAKE_PLAIN_1024
+};
+
+static_assert(Describe<Thousand>::num_fields == 1024);
+static_assert(std::is_same_v<Describe<Thousand>::Field<0>::Type, std::uint16_t>);
+static_assert(std::is_same_v<Describe<Thousand>::Field<1023>::Annotations, Annotate<>>);
+
+// Over a thousand fields interleaved with over five hundred annotations
+struct Protocol {
+  MAKE_PLAIN_256
+  MAKE_256
+  MAKE_PLAIN_256
+  MPC_ANNOTATE(Transient)
+  double checksum;
+  MAKE_256
+  MAKE_PLAIN_256
+  MPC_ANNOTATE(NoIo, NoCompare)
+  char last;
+};
+
+static_assert(Describe<Protocol>::num_fields == 5 * 256 + 2);
+static_assert(std::is_same_v<Describe<Protocol>::Field<255>::Type, std::uint16_t>);
+static_assert(std::is_same_v<Describe<Protocol>::Field<256>::Type, int>);
+static_assert(Describe<Protocol>::Field<256>::has_annotation_template<SerialId>);
+static_assert(std::is_same_v<Describe<Protocol>::Field<768>::Type, double>);
+static_assert(Describe<Protocol>::Field<768>::has_annotation_class<Transient>);
+static_assert(Describe<Protocol>::Field<1024>::has_annotation_class<SerialId<SizeT<5>>>);
+static_assert(std::is_same_v<Describe<Protocol>::Field<1025>::Type, std::uint16_t>);
+static_assert(std::is_same_v<Describe<Protocol>::Field<1281>::Type, char>);
+static_assert(std::is_same_v<Describe<Protocol>::Field<1281>::Annotations, Annotate<NoIo, NoCompare>>);
+
+TEST(AnnotationsTest, Thousand)
+{ }
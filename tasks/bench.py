@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Benchmark runner behind the `bench` target of tasks/CMakeLists.txt.
+
+compile: compiles a source once per value of a macro and records the wall
+         time and the peak resident memory of the compiler, and the size of
+         the object file.
+report:  merges the per-benchmark reports into one report of the task.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def peak_memory_kib(usage):
+    # ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+    if sys.platform == "darwin":
+        return usage.ru_maxrss // 1024
+    return usage.ru_maxrss
+
+
+def compile_once(command):
+    start = time.perf_counter()
+    process = subprocess.Popen(command)
+    # wait4 gives the usage of this child only, unlike getrusage
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        sys.exit(f"bench.py: `{' '.join(command)}` failed with code {process.returncode}")
+    return elapsed, peak_memory_kib(usage)
+
+
+def run_compile(args):
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        output = os.path.join(directory, "bench.o")
+        for value in args.values:
+            command = [args.compiler, *args.flags, f"-D{args.parameter}={value}",
+                       "-c", args.source, "-o", output]
+            # The best of several runs, the machine is rarely quiet
+            runs = [compile_once(command) for _ in range(args.repetitions)]
+            wall_time = min(elapsed for elapsed, _ in runs)
+            memory = max(kib for _, kib in runs)
+            size = os.path.getsize(output)
+            print(f"{args.parameter}={value}: {wall_time:.2f} s, {memory / 1024:.0f} MiB, "
+                  f"{size / 1024:.0f} KiB object")
+            results.append({
+                "value": int(value) if value.isdigit() else value,
+                "wall_time_s": round(wall_time, 3),
+                "peak_memory_kib": memory,
+                "object_size_bytes": size,
+            })
+
+    write_json(args.out, {
+        "source": args.source,
+        "parameter": args.parameter,
+        "repetitions": args.repetitions,
+        "results": results,
+    })
+
+
+def run_report(args):
+    report = {
+        "task": args.task,
+        "compiler": args.compiler,
+        "build_type": args.build_type,
+        "runtime": {},
+        "compile": {},
+    }
+    for entry in args.reports:
+        kind, name, path = entry.split(":", 2)
+        with open(path) as file:
+            data = json.load(file)
+        if kind == "runtime":
+            # google-benchmark's own format, without the machine description
+            report["runtime"][name] = data["benchmarks"]
+            report.setdefault("context", data["context"])
+        else:
+            report["compile"][name] = data
+
+    write_json(args.out, report)
+    print(f"bench.py: report written to {args.out}")
+
+
+def write_json(path, data):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as file:
+        json.dump(data, file, indent=2)
+        file.write("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    compile_parser = commands.add_parser("compile")
+    compile_parser.add_argument("--compiler", required=True)
+    compile_parser.add_argument("--source", required=True)
+    compile_parser.add_argument("--parameter", required=True)
+    compile_parser.add_argument("--values", nargs="+", required=True)
+    compile_parser.add_argument("--repetitions", type=int, default=3)
+    compile_parser.add_argument("--out", required=True)
+    compile_parser.add_argument("flags", nargs="*")
+
+    report_parser = commands.add_parser("report")
+    report_parser.add_argument("--task", required=True)
+    report_parser.add_argument("--compiler", default="")
+    report_parser.add_argument("--build-type", default="")
+    report_parser.add_argument("--out", required=True)
+    report_parser.add_argument("reports", nargs="*")
+
+    args = parser.parse_args()
+    if args.command == "compile":
+        run_compile(args)
+    else:
+        run_report(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+#include <EnumeratorTraits.hpp>
+
+#include <cstddef>
+
+// Compile-time benchmark, see make_compile_bench: the cost of
+// EnumeratorTraits grows with the MAXN scanned, not with the enumerators
+
+#ifndef MAXN
+#define MAXN 512
+#endif
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// Every enumerator is one more than the previous one
+#define MAKE_ENUMERATOR BENCH_CONCAT(VALUE_, __COUNTER__),
+
+#define MAKE_2 MAKE_ENUMERATOR MAKE_ENUMERATOR
+#define MAKE_4 MAKE_2 MAKE_2
+#define MAKE_8 MAKE_4 MAKE_4
+#define MAKE_16 MAKE_8 MAKE_8
+#define MAKE_32 MAKE_16 MAKE_16
+#define MAKE_64 MAKE_32 MAKE_32
+#define MAKE_128 MAKE_64 MAKE_64
+#define MAKE_256 MAKE_128 MAKE_128
+#define MAKE_512 MAKE_256 MAKE_256
+#define MAKE_1024 MAKE_512 MAKE_512
+#define MAKE_2048 MAKE_1024 MAKE_1024
+#define MAKE_4096 MAKE_2048 MAKE_2048
+#define MAKE_8192 MAKE_4096 MAKE_4096
+#define MAKE_16384 MAKE_8192 MAKE_8192
+#define MAKE_32768 MAKE_16384 MAKE_16384
+
+// Every value in [-16384, 16384], so that the largest MAXN is dense as well
+enum class Dense {
+  FIRST = -16384,
+  MAKE_32768
+};
+
+enum class Sparse {
+  FIRST = 1,
+  SECOND = 10,
+  THIRD = 100,
+};
+
+constexpr std::size_t kDense = MAXN < 16384 ? 2 * MAXN + 1 : 32769;
+
+static_assert(EnumeratorTraits<Dense, MAXN>::size() == kDense);
+static_assert(EnumeratorTraits<Sparse, MAXN>::size() == (MAXN >= 100 ? 3 : MAXN >= 10 ? 2 : 1));
@@ -0,0 +1,116 @@
+#include <EnumeratorTraits.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+enum class Permission : unsigned {
+    NONE = 0, READ = 1, WRITE = 2, EXECUTE = 4, STICKY = 1u << 31
+};
+
+template <>
+struct EnumeratorFlags<Permission> : std::true_type {};
+
+enum Feature : std::uint64_t {
+    F_FIRST = 1, F_SECOND = 1ull << 20, F_FAR = 1ull << 40, F_LAST = 1ull << 63
+};
+
+template <>
+struct EnumeratorFlags<Feature> : std::true_type {};
+
+enum class Mode : signed char {
+    FAST = 1, SAFE = 64
+};
+
+template <>
+struct EnumeratorFlags<Mode> : std::true_type {};
+
+enum class Shape {
+    SQUARE, CIRCLE = 5, LINE, POINT = -2
+};
+
+
+// Only zero and powers of two are looked at, whatever MAXN is
+static_assert(EnumeratorTraits<Permission>::size() == 5);
+static_assert(EnumeratorTraits<Permission>::nameAt(0) == "NONE");
+static_assert(EnumeratorTraits<Permission>::at(3) == Permission::EXECUTE);
+static_assert(EnumeratorTraits<Permission>::nameAt(4) == "STICKY");
+
+static_assert(EnumeratorTraits<Feature>::size() == 4);
+static_assert(EnumeratorTraits<Feature>::nameAt(2) == "F_FAR");
+static_assert(EnumeratorTraits<Feature>::at(3) == F_LAST);
+
+static_assert(EnumeratorTraits<Mode>::size() == 2);
+static_assert(EnumeratorTraits<Mode>::at(1) == Mode::SAFE);
+
+
+// Exactly as many bits as there are enumerators, rounded up to words
+static_assert(sizeof(FlagSet<Mode>) <= sizeof(std::uint64_t));
+static_assert(sizeof(FlagSet<Feature>) <= sizeof(std::uint64_t));
+static_assert(sizeof(FlagSet<Shape>) <= sizeof(std::uint64_t));
+
+static_assert(std::regular<FlagSet<Permission>>);
+static_assert(std::is_trivially_copyable_v<FlagSet<Permission>>);
+
+// Works for any enum, not only flags
+static_assert(FlagSet<Shape>{Shape::LINE, Shape::POINT}.count() == 2);
+static_assert(FlagSet<Shape>{Shape::LINE}.contains(Shape::LINE));
+static_assert(!FlagSet<Shape>{Shape::LINE}.contains(Shape::POINT));
+
+
+TEST(FlagSetTest, SetOperations)
+{
+    using Set = FlagSet<Permission>;
+    const Set rw{Permission::READ, Permission::WRITE};
+    const Set wx{Permission::WRITE, Permission::EXECUTE};
+
+    MPC_REQUIRE(eq, std::size_t{0}, Set{}.count());
+    MPC_REQUIRE(true, Set{}.empty());
+    MPC_REQUIRE(eq, std::size_t{2}, rw.count());
+
+    MPC_REQUIRE(eq, (Set{Permission::READ, Permission::WRITE, Permission::EXECUTE}), rw | wx);
+    MPC_REQUIRE(eq, Set{Permission::WRITE}, rw & wx);
+    MPC_REQUIRE(eq, (Set{Permission::READ, Permission::EXECUTE}), rw ^ wx);
+    MPC_REQUIRE(eq, (Set{Permission::NONE, Permission::EXECUTE, Permission::STICKY}), ~rw);
+    MPC_REQUIRE(eq, std::size_t{5}, (rw | ~rw).count());
+
+    Set s;
+    s.insert(Permission::STICKY);
+    s |= rw;
+    MPC_REQUIRE(eq, std::size_t{3}, s.count());
+    s.erase(Permission::READ);
+    MPC_REQUIRE(eq, (Set{Permission::WRITE, Permission::STICKY}), s);
+    s &= wx;
+    MPC_REQUIRE(eq, Set{Permission::WRITE}, s);
+    s ^= wx;
+    MPC_REQUIRE(eq, Set{Permission::EXECUTE}, s);
+}
+
+TEST(FlagSetTest, ToString)
+{
+    MPC_REQUIRE(eq, std::string(""), FlagSet<Permission>{}.toString());
+    MPC_REQUIRE(eq, std::string("READ"), FlagSet<Permission>{Permission::READ}.toString());
+    // In the order of enumerators, not of insertion
+    MPC_REQUIRE(eq, std::string("READ|EXECUTE|STICKY"),
+        (FlagSet<Permission>{Permission::STICKY, Permission::READ, Permission::EXECUTE}.toString()));
+    MPC_REQUIRE(eq, std::string("F_FIRST|F_LAST"), (FlagSet<Feature>{F_LAST, F_FIRST}.toString()));
+    MPC_REQUIRE(eq, std::string("POINT|SQUARE|CIRCLE|LINE"), (~FlagSet<Shape>{}).toString());
+}
+
+TEST(FlagSetTest, Values)
+{
+    // Raw values go through the enumerators, unknown bits are dropped
+    const auto set = FlagSet<Feature>::fromValue(F_FIRST | F_FAR | (1ull << 5));
+    MPC_REQUIRE(eq, (FlagSet<Feature>{F_FIRST, F_FAR}), set);
+    MPC_REQUIRE(eq, std::uint64_t{F_FIRST | F_FAR}, set.value());
+
+    MPC_REQUIRE(eq, 0u, FlagSet<Permission>{Permission::NONE}.value());
+    MPC_REQUIRE(eq, 7u, FlagSet<Permission>::fromValue(7).value());
+}
@@ -0,0 +1,92 @@
+#include <EnumeratorTraits.hpp>
+
+#include "scoped_enum.hpp"
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+enum class Shape {
+    SQUARE, CIRCLE = 5, LINE, POINT = -2
+};
+
+// Few enumerators spread over the whole range
+enum Sparse : short {
+    FIRST = -512, SECOND = -3, THIRD = 100, FOURTH = 511
+};
+
+enum class Empty {};
+
+// Names sharing long prefixes and differing in one letter
+enum class Similar : unsigned char {
+    A, AA, AAA, AAB, ABA, BAA, B
+};
+
+
+// check compile time capabilities
+static_assert(EnumeratorTraits<Shape>::fromName("POINT") == Shape::POINT);
+static_assert(EnumeratorTraits<Shape>::fromName("LINE") == Shape::LINE);
+static_assert(!EnumeratorTraits<Shape>::fromName("TRIANGLE").has_value());
+static_assert(EnumeratorTraits<Shape>::indexOf(Shape::POINT) == 0);
+static_assert(EnumeratorTraits<Shape>::indexOf(Shape::LINE) == 3);
+static_assert(!EnumeratorTraits<Shape>::indexOf(static_cast<Shape>(1)).has_value());
+
+static_assert(std::same_as<decltype(EnumeratorTraits<Shape>::fromName("")), std::optional<Shape>>);
+static_assert(std::same_as<decltype(EnumeratorTraits<Shape>::indexOf(Shape::LINE)), std::optional<std::size_t>>);
+static_assert(noexcept(EnumeratorTraits<Shape>::fromName("")));
+static_assert(noexcept(EnumeratorTraits<Shape>::indexOf(Shape::LINE)));
+
+
+template <class Enum, std::size_t MAXN = 512>
+void checkRoundTrip() {
+    using Traits = EnumeratorTraits<Enum, MAXN>;
+    for (std::size_t i = 0; i < Traits::size(); ++i) {
+        MPC_REQUIRE(eq, std::optional{Traits::at(i)}, Traits::fromName(Traits::nameAt(i)));
+        MPC_REQUIRE(eq, std::optional{i}, Traits::indexOf(Traits::at(i)));
+    }
+}
+
+TEST(LookupTest, RoundTrip)
+{
+    checkRoundTrip<Shape>();
+    checkRoundTrip<Sparse>();
+    checkRoundTrip<Empty>();
+    checkRoundTrip<Similar>();
+    checkRoundTrip<ScopedEnum>();
+}
+
+TEST(LookupTest, NameMisses)
+{
+    using Traits = EnumeratorTraits<Similar>;
+    for (std::string_view name : {"", "C", "BB", "AAAA", "AB", "a", "AA ", " AA", "Similar::A"}) {
+        MPC_REQUIRE(nullopt, Traits::fromName(name));
+    }
+
+    using Stress = EnumeratorTraits<ScopedEnum>;
+    MPC_REQUIRE(eq, std::optional{ScopedEnum::VALUE_N_51}, Stress::fromName("VALUE_N_51"));
+    for (std::string_view name : {"VALUE_513", "VALUE_N_513", "VALUE_", "VALUE_N_", "VALUE_-1", "value_1", "VALUE_0001"}) {
+        MPC_REQUIRE(nullopt, Stress::fromName(name));
+    }
+
+    // Looked up by contents, the storage does not matter
+    std::string name = "VALUE_N_";
+    name += "42";
+    MPC_REQUIRE(eq, std::optional{ScopedEnum::VALUE_N_42}, Stress::fromName(name));
+}
+
+TEST(LookupTest, ValueMisses)
+{
+    for (short value : {-511, -4, -2, 0, 99, 101, 510, 512}) {
+        MPC_REQUIRE(nullopt, EnumeratorTraits<Sparse>::indexOf(static_cast<Sparse>(value)));
+    }
+    // Values outside of [-MAXN, MAXN] are not enumerators either
+    MPC_REQUIRE(nullopt, EnumeratorTraits<ScopedEnum>::indexOf(static_cast<ScopedEnum>(513)));
+    MPC_REQUIRE(nullopt, EnumeratorTraits<ScopedEnum>::indexOf(static_cast<ScopedEnum>(-100000)));
+    MPC_REQUIRE(nullopt, EnumeratorTraits<Empty>::indexOf(static_cast<Empty>(0)));
+}
@@ -0,0 +1,113 @@
+#include <EnumeratorTraits.hpp>
+
+#include "scoped_enum.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// fromName and indexOf against the loops over nameAt and at they replace,
+// on the 1025 enumerators of ScopedEnum, as a config loader would call them
+
+using Traits = EnumeratorTraits<ScopedEnum>;
+
+constexpr std::size_t kQueries = 1 << 12;
+
+// Every eighth name is not an enumerator
+std::vector<std::string> MakeNames() {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> distribution(0, Traits::size() - 1);
+    std::vector<std::string> names(kQueries);
+    for (std::size_t i = 0; i < kQueries; ++i) {
+        names[i] = Traits::nameAt(distribution(generator));
+        if (i % 8 == 0) {
+            names[i].back() = 'X';
+        }
+    }
+    return names;
+}
+
+std::vector<ScopedEnum> MakeValues() {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> distribution(0, Traits::size() - 1);
+    std::vector<ScopedEnum> values(kQueries);
+    for (ScopedEnum& value : values) {
+        value = Traits::at(distribution(generator));
+    }
+    return values;
+}
+
+std::optional<ScopedEnum> linearFromName(std::string_view name) {
+    for (std::size_t i = 0; i < Traits::size(); ++i) {
+        if (Traits::nameAt(i) == name) {
+            return Traits::at(i);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::size_t> linearIndexOf(ScopedEnum value) {
+    for (std::size_t i = 0; i < Traits::size(); ++i) {
+        if (Traits::at(i) == value) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+void BM_FromName(benchmark::State& state) {
+    auto names = MakeNames();
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const std::string& name : names) {
+            found += Traits::fromName(name).has_value();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_FromName);
+
+void BM_LinearFromName(benchmark::State& state) {
+    auto names = MakeNames();
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const std::string& name : names) {
+            found += linearFromName(name).has_value();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_LinearFromName);
+
+void BM_IndexOf(benchmark::State& state) {
+    auto values = MakeValues();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (ScopedEnum value : values) {
+            sum += *Traits::indexOf(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_IndexOf);
+
+void BM_LinearIndexOf(benchmark::State& state) {
+    auto values = MakeValues();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (ScopedEnum value : values) {
+            sum += *linearIndexOf(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_LinearIndexOf);
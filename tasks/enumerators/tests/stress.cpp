@@ -1,1034 +1,8 @@
 #include <EnumeratorTraits.hpp>
 
-#include <gtest/gtest.h>
+#include "scoped_enum.hpp"
 
-enum class ScopedEnum {
-    VALUE_N_512 = -512,
-    VALUE_N_511 = -511,
-    VALUE_N_510 = -510,
-    VALUE_N_509 = -509,
-    VALUE_N_508 = -508,
-    VALUE_N_507 = -507,
-    VALUE_N_506 = -506,
-    VALUE_N_505 = -505,
-    VALUE_N_504 = -504,
-    VALUE_N_503 = -503,
-    VALUE_N_502 = -502,
-    VALUE_N_501 = -501,
-    VALUE_N_500 = -500,
-    VALUE_N_499 = -499,
-    VALUE_N_498 = -498,
-    VALUE_N_497 = -497,
-    VALUE_N_496 = -496,
-    VALUE_N_495 = -495,
-    VALUE_N_494 = -494,
-    VALUE_N_493 = -493,
-    VALUE_N_492 = -492,
-    VALUE_N_491 = -491,
-    VALUE_N_490 = -490,
-    VALUE_N_489 = -489,
-    VALUE_N_488 = -488,
-    VALUE_N_487 = -487,
-    VALUE_N_486 = -486,
-    VALUE_N_485 = -485,
-    VALUE_N_484 = -484,
-    VALUE_N_483 = -483,
-    VALUE_N_482 = -482,
-    VALUE_N_481 = -481,
-    VALUE_N_480 = -480,
-    VALUE_N_479 = -479,
-    VALUE_N_478 = -478,
-    VALUE_N_477 = -477,
-    VALUE_N_476 = -476,
-    VALUE_N_475 = -475,
-    VALUE_N_474 = -474,
-    VALUE_N_473 = -473,
-    VALUE_N_472 = -472,
-    VALUE_N_471 = -471,
-    VALUE_N_470 = -470,
-    VALUE_N_469 = -469,
-    VALUE_N_468 = -468,
-    VALUE_N_467 = -467,
-    VALUE_N_466 = -466,
-    VALUE_N_465 = -465,
-    VALUE_N_464 = -464,
-    VALUE_N_463 = -463,
-    VALUE_N_462 = -462,
-    VALUE_N_461 = -461,
-    VALUE_N_460 = -460,
-    VALUE_N_459 = -459,
-    VALUE_N_458 = -458,
-    VALUE_N_457 = -457,
-    VALUE_N_456 = -456,
-    VALUE_N_455 = -455,
-    VALUE_N_454 = -454,
-    VALUE_N_453 = -453,
-    VALUE_N_452 = -452,
-    VALUE_N_451 = -451,
-    VALUE_N_450 = -450,
-    VALUE_N_449 = -449,
-    VALUE_N_448 = -448,
-    VALUE_N_447 = -447,
-    VALUE_N_446 = -446,
-    VALUE_N_445 = -445,
-    VALUE_N_444 = -444,
-    VALUE_N_443 = -443,
-    VALUE_N_442 = -442,
-    VALUE_N_441 = -441,
-    VALUE_N_440 = -440,
-    VALUE_N_439 = -439,
-    VALUE_N_438 = -438,
-    VALUE_N_437 = -437,
-    VALUE_N_436 = -436,
-    VALUE_N_435 = -435,
-    VALUE_N_434 = -434,
-    VALUE_N_433 = -433,
-    VALUE_N_432 = -432,
-    VALUE_N_431 = -431,
-    VALUE_N_430 = -430,
-    VALUE_N_429 = -429,
-    VALUE_N_428 = -428,
-    VALUE_N_427 = -427,
-    VALUE_N_426 = -426,
-    VALUE_N_425 = -425,
-    VALUE_N_424 = -424,
-    VALUE_N_423 = -423,
-    VALUE_N_422 = -422,
-    VALUE_N_421 = -421,
-    VALUE_N_420 = -420,
-    VALUE_N_419 = -419,
-    VALUE_N_418 = -418,
-    VALUE_N_417 = -417,
-    VALUE_N_416 = -416,
-    VALUE_N_415 = -415,
-    VALUE_N_414 = -414,
-    VALUE_N_413 = -413,
-    VALUE_N_412 = -412,
-    VALUE_N_411 = -411,
-    VALUE_N_410 = -410,
-    VALUE_N_409 = -409,
-    VALUE_N_408 = -408,
-    VALUE_N_407 = -407,
-    VALUE_N_406 = -406,
-    VALUE_N_405 = -405,
-    VALUE_N_404 = -404,
-    VALUE_N_403 = -403,
-    VALUE_N_402 = -402,
-    VALUE_N_401 = -401,
-    VALUE_N_400 = -400,
-    VALUE_N_399 = -399,
-    VALUE_N_398 = -398,
-    VALUE_N_397 = -397,
-    VALUE_N_396 = -396,
-    VALUE_N_395 = -395,
-    VALUE_N_394 = -394,
-    VALUE_N_393 = -393,
-    VALUE_N_392 = -392,
-    VALUE_N_391 = -391,
-    VALUE_N_390 = -390,
-    VALUE_N_389 = -389,
-    VALUE_N_388 = -388,
-    VALUE_N_387 = -387,
-    VALUE_N_386 = -386,
-    VALUE_N_385 = -385,
-    VALUE_N_384 = -384,
-    VALUE_N_383 = -383,
-    VALUE_N_382 = -382,
-    VALUE_N_381 = -381,
-    VALUE_N_380 = -380,
-    VALUE_N_379 = -379,
-    VALUE_N_378 = -378,
-    VALUE_N_377 = -377,
-    VALUE_N_376 = -376,
-    VALUE_N_375 = -375,
-    VALUE_N_374 = -374,
-    VALUE_N_373 = -373,
-    VALUE_N_372 = -372,
-    VALUE_N_371 = -371,
-    VALUE_N_370 = -370,
-    VALUE_N_369 = -369,
-    VALUE_N_368 = -368,
-    VALUE_N_367 = -367,
-    VALUE_N_366 = -366,
-    VALUE_N_365 = -365,
-    VALUE_N_364 = -364,
-    VALUE_N_363 = -363,
-    VALUE_N_362 = -362,
-    VALUE_N_361 = -361,
-    VALUE_N_360 = -360,
-    VALUE_N_359 = -359,
-    VALUE_N_358 = -358,
-    VALUE_N_357 = -357,
-    VALUE_N_356 = -356,
-    VALUE_N_355 = -355,
-    VALUE_N_354 = -354,
-    VALUE_N_353 = -353,
-    VALUE_N_352 = -352,
-    VALUE_N_351 = -351,
-    VALUE_N_350 = -350,
-    VALUE_N_349 = -349,
-    VALUE_N_348 = -348,
-    VALUE_N_347 = -347,
-    VALUE_N_346 = -346,
-    VALUE_N_345 = -345,
-    VALUE_N_344 = -344,
-    VALUE_N_343 = -343,
-    VALUE_N_342 = -342,
-    VALUE_N_341 = -341,
-    VALUE_N_340 = -340,
-    VALUE_N_339 = -339,
-    VALUE_N_338 = -338,
-    VALUE_N_337 = -337,
-    VALUE_N_336 = -336,
-    VALUE_N_335 = -335,
-    VALUE_N_334 = -334,
-    VALUE_N_333 = -333,
-    VALUE_N_332 = -332,
-    VALUE_N_331 = -331,
-    VALUE_N_330 = -330,
-    VALUE_N_329 = -329,
-    VALUE_N_328 = -328,
-    VALUE_N_327 = -327,
-    VALUE_N_326 = -326,
-    VALUE_N_325 = -325,
-    VALUE_N_324 = -324,
-    VALUE_N_323 = -323,
-    VALUE_N_322 = -322,
-    VALUE_N_321 = -321,
-    VALUE_N_320 = -320,
-    VALUE_N_319 = -319,
-    VALUE_N_318 = -318,
-    VALUE_N_317 = -317,
-    VALUE_N_316 = -316,
-    VALUE_N_315 = -315,
-    VALUE_N_314 = -314,
-    VALUE_N_313 = -313,
-    VALUE_N_312 = -312,
-    VALUE_N_311 = -311,
-    VALUE_N_310 = -310,
-    VALUE_N_309 = -309,
-    VALUE_N_308 = -308,
-    VALUE_N_307 = -307,
-    VALUE_N_306 = -306,
-    VALUE_N_305 = -305,
-    VALUE_N_304 = -304,
-    VALUE_N_303 = -303,
-    VALUE_N_302 = -302,
-    VALUE_N_301 = -301,
-    VALUE_N_300 = -300,
-    VALUE_N_299 = -299,
-    VALUE_N_298 = -298,
-    VALUE_N_297 = -297,
-    VALUE_N_296 = -296,
-    VALUE_N_295 = -295,
-    VALUE_N_294 = -294,
-    VALUE_N_293 = -293,
-    VALUE_N_292 = -292,
-    VALUE_N_291 = -291,
-    VALUE_N_290 = -290,
-    VALUE_N_289 = -289,
-    VALUE_N_288 = -288,
-    VALUE_N_287 = -287,
-    VALUE_N_286 = -286,
-    VALUE_N_285 = -285,
-    VALUE_N_284 = -284,
-    VALUE_N_283 = -283,
-    VALUE_N_282 = -282,
-    VALUE_N_281 = -281,
-    VALUE_N_280 = -280,
-    VALUE_N_279 = -279,
-    VALUE_N_278 = -278,
-    VALUE_N_277 = -277,
-    VALUE_N_276 = -276,
-    VALUE_N_275 = -275,
-    VALUE_N_274 = -274,
-    VALUE_N_273 = -273,
-    VALUE_N_272 = -272,
-    VALUE_N_271 = -271,
-    VALUE_N_270 = -270,
-    VALUE_N_269 = -269,
-    VALUE_N_268 = -268,
-    VALUE_N_267 = -267,
-    VALUE_N_266 = -266,
-    VALUE_N_265 = -265,
-    VALUE_N_264 = -264,
-    VALUE_N_263 = -263,
-    VALUE_N_262 = -262,
-    VALUE_N_261 = -261,
-    VALUE_N_260 = -260,
-    VALUE_N_259 = -259,
-    VALUE_N_258 = -258,
-    VALUE_N_257 = -257,
-    VALUE_N_256 = -256,
-    VALUE_N_255 = -255,
-    VALUE_N_254 = -254,
-    VALUE_N_253 = -253,
-    VALUE_N_252 = -252,
-    VALUE_N_251 = -251,
-    VALUE_N_250 = -250,
-    VALUE_N_249 = -249,
-    VALUE_N_248 = -248,
-    VALUE_N_247 = -247,
-    VALUE_N_246 = -246,
-    VALUE_N_245 = -245,
-    VALUE_N_244 = -244,
-    VALUE_N_243 = -243,
-    VALUE_N_242 = -242,
-    VALUE_N_241 = -241,
-    VALUE_N_240 = -240,
-    VALUE_N_239 = -239,
-    VALUE_N_238 = -238,
-    VALUE_N_237 = -237,
-    VALUE_N_236 = -236,
-    VALUE_N_235 = -235,
-    VALUE_N_234 = -234,
-    VALUE_N_233 = -233,
-    VALUE_N_232 = -232,
-    VALUE_N_231 = -231,
-    VALUE_N_230 = -230,
-    VALUE_N_229 = -229,
-    VALUE_N_228 = -228,
-    VALUE_N_227 = -227,
-    VALUE_N_226 = -226,
-    VALUE_N_225 = -225,
-    VALUE_N_224 = -224,
-    VALUE_N_223 = -223,
-    VALUE_N_222 = -222,
-    VALUE_N_221 = -221,
-    VALUE_N_220 = -220,
-    VALUE_N_219 = -219,
-    VALUE_N_218 = -218,
-    VALUE_N_217 = -217,
-    VALUE_N_216 = -216,
-    VALUE_N_215 = -215,
-    VALUE_N_214 = -214,
-    VALUE_N_213 = -213,
-    VALUE_N_212 = -212,
-    VALUE_N_211 = -211,
-    VALUE_N_210 = -210,
-    VALUE_N_209 = -209,
-    VALUE_N_208 = -208,
-    VALUE_N_207 = -207,
-    VALUE_N_206 = -206,
-    VALUE_N_205 = -205,
-    VALUE_N_204 = -204,
-    VALUE_N_203 = -203,
-    VALUE_N_202 = -202,
-    VALUE_N_201 = -201,
-    VALUE_N_200 = -200,
-    VALUE_N_199 = -199,
-    VALUE_N_198 = -198,
-    VALUE_N_197 = -197,
-    VALUE_N_196 = -196,
-    VALUE_N_195 = -195,
-    VALUE_N_194 = -194,
-    VALUE_N_193 = -193,
-    VALUE_N_192 = -192,
-    VALUE_N_191 = -191,
-    VALUE_N_190 = -190,
-    VALUE_N_189 = -189,
-    VALUE_N_188 = -188,
-    VALUE_N_187 = -187,
-    VALUE_N_186 = -186,
-    VALUE_N_185 = -185,
-    VALUE_N_184 = -184,
-    VALUE_N_183 = -183,
-    VALUE_N_182 = -182,
-    VALUE_N_181 = -181,
-    VALUE_N_180 = -180,
-    VALUE_N_179 = -179,
-    VALUE_N_178 = -178,
-    VALUE_N_177 = -177,
-    VALUE_N_176 = -176,
-    VALUE_N_175 = -175,
-    VALUE_N_174 = -174,
-    VALUE_N_173 = -173,
-    VALUE_N_172 = -172,
-    VALUE_N_171 = -171,
-    VALUE_N_170 = -170,
-    VALUE_N_169 = -169,
-    VALUE_N_168 = -168,
-    VALUE_N_167 = -167,
-    VALUE_N_166 = -166,
-    VALUE_N_165 = -165,
-    VALUE_N_164 = -164,
-    VALUE_N_163 = -163,
-    VALUE_N_162 = -162,
-    VALUE_N_161 = -161,
-    VALUE_N_160 = -160,
-    VALUE_N_159 = -159,
-    VALUE_N_158 = -158,
-    VALUE_N_157 = -157,
-    VALUE_N_156 = -156,
-    VALUE_N_155 = -155,
-    VALUE_N_154 = -154,
-    VALUE_N_153 = -153,
-    VALUE_N_152 = -152,
-    VALUE_N_151 = -151,
-    VALUE_N_150 = -150,
-    VALUE_N_149 = -149,
-    VALUE_N_148 = -148,
-    VALUE_N_147 = -147,
-    VALUE_N_146 = -146,
-    VALUE_N_145 = -145,
-    VALUE_N_144 = -144,
-    VALUE_N_143 = -143,
-    VALUE_N_142 = -142,
-    VALUE_N_141 = -141,
-    VALUE_N_140 = -140,
-    VALUE_N_139 = -139,
-    VALUE_N_138 = -138,
-    VALUE_N_137 = -137,
-    VALUE_N_136 = -136,
-    VALUE_N_135 = -135,
-    VALUE_N_134 = -134,
-    VALUE_N_133 = -133,
-    VALUE_N_132 = -132,
-    VALUE_N_131 = -131,
-    VALUE_N_130 = -130,
-    VALUE_N_129 = -129,
-    VALUE_N_128 = -128,
-    VALUE_N_127 = -127,
-    VALUE_N_126 = -126,
-    VALUE_N_125 = -125,
-    VALUE_N_124 = -124,
-    VALUE_N_123 = -123,
-    VALUE_N_122 = -122,
-    VALUE_N_121 = -121,
-    VALUE_N_120 = -120,
-    VALUE_N_119 = -119,
-    VALUE_N_118 = -118,
-    VALUE_N_117 = -117,
-    VALUE_N_116 = -116,
-    VALUE_N_115 = -115,
-    VALUE_N_114 = -114,
-    VALUE_N_113 = -113,
-    VALUE_N_112 = -112,
-    VALUE_N_111 = -111,
-    VALUE_N_110 = -110,
-    VALUE_N_109 = -109,
-    VALUE_N_108 = -108,
-    VALUE_N_107 = -107,
-    VALUE_N_106 = -106,
-    VALUE_N_105 = -105,
-    VALUE_N_104 = -104,
-    VALUE_N_103 = -103,
-    VALUE_N_102 = -102,
-    VALUE_N_101 = -101,
-    VALUE_N_100 = -100,
-    VALUE_N_99 = -99,
-    VALUE_N_98 = -98,
-    VALUE_N_97 = -97,
-    VALUE_N_96 = -96,
-    VALUE_N_95 = -95,
-    VALUE_N_94 = -94,
-    VALUE_N_93 = -93,
-    VALUE_N_92 = -92,
-    VALUE_N_91 = -91,
-    VALUE_N_90 = -90,
-    VALUE_N_89 = -89,
-    VALUE_N_88 = -88,
-    VALUE_N_87 = -87,
-    VALUE_N_86 = -86,
-    VALUE_N_85 = -85,
-    VALUE_N_84 = -84,
-    VALUE_N_83 = -83,
-    VALUE_N_82 = -82,
-    VALUE_N_81 = -81,
-    VALUE_N_80 = -80,
-    VALUE_N_79 = -79,
-    VALUE_N_78 = -78,
-    VALUE_N_77 = -77,
-    VALUE_N_76 = -76,
-    VALUE_N_75 = -75,
-    VALUE_N_74 = -74,
-    VALUE_N_73 = -73,
-    VALUE_N_72 = -72,
-    VALUE_N_71 = -71,
-    VALUE_N_70 = -70,
-    VALUE_N_69 = -69,
-    VALUE_N_68 = -68,
-    VALUE_N_67 = -67,
-    VALUE_N_66 = -66,
-    VALUE_N_65 = -65,
-    VALUE_N_64 = -64,
-    VALUE_N_63 = -63,
-    VALUE_N_62 = -62,
-    VALUE_N_61 = -61,
-    VALUE_N_60 = -60,
-    VALUE_N_59 = -59,
-    VALUE_N_58 = -58,
-    VALUE_N_57 = -57,
-    VALUE_N_56 = -56,
-    VALUE_N_55 = -55,
-    VALUE_N_54 = -54,
-    VALUE_N_53 = -53,
-    VALUE_N_52 = -52,
-    VALUE_N_51 = -51,
-    VALUE_N_50 = -50,
-    VALUE_N_49 = -49,
-    VALUE_N_48 = -48,
-    VALUE_N_47 = -47,
-    VALUE_N_46 = -46,
-    VALUE_N_45 = -45,
-    VALUE_N_44 = -44,
-    VALUE_N_43 = -43,
-    VALUE_N_42 = -42,
-    VALUE_N_41 = -41,
-    VALUE_N_40 = -40,
-    VALUE_N_39 = -39,
-    VALUE_N_38 = -38,
-    VALUE_N_37 = -37,
-    VALUE_N_36 = -36,
-    VALUE_N_35 = -35,
-    VALUE_N_34 = -34,
-    VALUE_N_33 = -33,
-    VALUE_N_32 = -32,
-    VALUE_N_31 = -31,
-    VALUE_N_30 = -30,
-    VALUE_N_29 = -29,
-    VALUE_N_28 = -28,
-    VALUE_N_27 = -27,
-    VALUE_N_26 = -26,
-    VALUE_N_25 = -25,
-    VALUE_N_24 = -24,
-    VALUE_N_23 = -23,
-    VALUE_N_22 = -22,
-    VALUE_N_21 = -21,
-    VALUE_N_20 = -20,
-    VALUE_N_19 = -19,
-    VALUE_N_18 = -18,
-    VALUE_N_17 = -17,
-    VALUE_N_16 = -16,
-    VALUE_N_15 = -15,
-    VALUE_N_14 = -14,
-    VALUE_N_13 = -13,
-    VALUE_N_12 = -12,
-    VALUE_N_11 = -11,
-    VALUE_N_10 = -10,
-    VALUE_N_9 = -9,
-    VALUE_N_8 = -8,
-    VALUE_N_7 = -7,
-    VALUE_N_6 = -6,
-    VALUE_N_5 = -5,
-    VALUE_N_4 = -4,
-    VALUE_N_3 = -3,
-    VALUE_N_2 = -2,
-    VALUE_N_1 = -1,
-    VALUE_0 = 0,
-    VALUE_1 = 1,
-    VALUE_2 = 2,
-    VALUE_3 = 3,
-    VALUE_4 = 4,
-    VALUE_5 = 5,
-    VALUE_6 = 6,
-    VALUE_7 = 7,
-    VALUE_8 = 8,
-    VALUE_9 = 9,
-    VALUE_10 = 10,
-    VALUE_11 = 11,
-    VALUE_12 = 12,
-    VALUE_13 = 13,
-    VALUE_14 = 14,
-    VALUE_15 = 15,
-    VALUE_16 = 16,
-    VALUE_17 = 17,
-    VALUE_18 = 18,
-    VALUE_19 = 19,
-    VALUE_20 = 20,
-    VALUE_21 = 21,
-    VALUE_22 = 22,
-    VALUE_23 = 23,
-    VALUE_24 = 24,
-    VALUE_25 = 25,
-    VALUE_26 = 26,
-    VALUE_27 = 27,
-    VALUE_28 = 28,
-    VALUE_29 = 29,
-    VALUE_30 = 30,
-    VALUE_31 = 31,
-    VALUE_32 = 32,
-    VALUE_33 = 33,
-    VALUE_34 = 34,
-    VALUE_35 = 35,
-    VALUE_36 = 36,
-    VALUE_37 = 37,
-    VALUE_38 = 38,
-    VALUE_39 = 39,
-    VALUE_40 = 40,
-    VALUE_41 = 41,
-    VALUE_42 = 42,
-    VALUE_43 = 43,
-    VALUE_44 = 44,
-    VALUE_45 = 45,
-    VALUE_46 = 46,
-    VALUE_47 = 47,
-    VALUE_48 = 48,
-    VALUE_49 = 49,
-    VALUE_50 = 50,
-    VALUE_51 = 51,
-    VALUE_52 = 52,
-    VALUE_53 = 53,
-    VALUE_54 = 54,
-    VALUE_55 = 55,
-    VALUE_56 = 56,
-    VALUE_57 = 57,
-    VALUE_58 = 58,
-    VALUE_59 = 59,
-    VALUE_60 = 60,
-    VALUE_61 = 61,
-    VALUE_62 = 62,
-    VALUE_63 = 63,
-    VALUE_64 = 64,
-    VALUE_65 = 65,
-    VALUE_66 = 66,
-    VALUE_67 = 67,
-    VALUE_68 = 68,
-    VALUE_69 = 69,
-    VALUE_70 = 70,
-    VALUE_71 = 71,
-    VALUE_72 = 72,
-    VALUE_73 = 73,
-    VALUE_74 = 74,
-    VALUE_75 = 75,
-    VALUE_76 = 76,
-    VALUE_77 = 77,
-    VALUE_78 = 78,
-    VALUE_79 = 79,
-    VALUE_80 = 80,
-    VALUE_81 = 81,
-    VALUE_82 = 82,
-    VALUE_83 = 83,
-    VALUE_84 = 84,
-    VALUE_85 = 85,
-    VALUE_86 = 86,
-    VALUE_87 = 87,
-    VALUE_88 = 88,
-    VALUE_89 = 89,
-    VALUE_90 = 90,
-    VALUE_91 = 91,
-    VALUE_92 = 92,
-    VALUE_93 = 93,
-    VALUE_94 = 94,
-    VALUE_95 = 95,
-    VALUE_96 = 96,
-    VALUE_97 = 97,
-    VALUE_98 = 98,
-    VALUE_99 = 99,
-    VALUE_100 = 100,
-    VALUE_101 = 101,
-    VALUE_102 = 102,
-    VALUE_103 = 103,
-    VALUE_104 = 104,
-    VALUE_105 = 105,
-    VALUE_106 = 106,
-    VALUE_107 = 107,
-    VALUE_108 = 108,
-    VALUE_109 = 109,
-    VALUE_110 = 110,
-    VALUE_111 = 111,
-    VALUE_112 = 112,
-    VALUE_113 = 113,
-    VALUE_114 = 114,
-    VALUE_115 = 115,
-    VALUE_116 = 116,
-    VALUE_117 = 117,
-    VALUE_118 = 118,
-    VALUE_119 = 119,
-    VALUE_120 = 120,
-    VALUE_121 = 121,
-    VALUE_122 = 122,
-    VALUE_123 = 123,
-    VALUE_124 = 124,
-    VALUE_125 = 125,
-    VALUE_126 = 126,
-    VALUE_127 = 127,
-    VALUE_128 = 128,
-    VALUE_129 = 129,
-    VALUE_130 = 130,
-    VALUE_131 = 131,
-    VALUE_132 = 132,
-    VALUE_133 = 133,
-    VALUE_134 = 134,
-    VALUE_135 = 135,
-    VALUE_136 = 136,
-    VALUE_137 = 137,
-    VALUE_138 = 138,
-    VALUE_139 = 139,
-    VALUE_140 = 140,
-    VALUE_141 = 141,
-    VALUE_142 = 142,
-    VALUE_143 = 143,
-    VALUE_144 = 144,
-    VALUE_145 = 145,
-    VALUE_146 = 146,
-    VALUE_147 = 147,
-    VALUE_148 = 148,
-    VALUE_149 = 149,
-    VALUE_150 = 150,
-    VALUE_151 = 151,
-    VALUE_152 = 152,
-    VALUE_153 = 153,
-    VALUE_154 = 154,
-    VALUE_155 = 155,
-    VALUE_156 = 156,
-    VALUE_157 = 157,
-    VALUE_158 = 158,
-    VALUE_159 = 159,
-    VALUE_160 = 160,
-    VALUE_161 = 161,
-    VALUE_162 = 162,
-    VALUE_163 = 163,
-    VALUE_164 = 164,
-    VALUE_165 = 165,
-    VALUE_166 = 166,
-    VALUE_167 = 167,
-    VALUE_168 = 168,
-    VALUE_169 = 169,
-    VALUE_170 = 170,
-    VALUE_171 = 171,
-    VALUE_172 = 172,
-    VALUE_173 = 173,
-    VALUE_174 = 174,
-    VALUE_175 = 175,
-    VALUE_176 = 176,
-    VALUE_177 = 177,
-    VALUE_178 = 178,
-    VALUE_179 = 179,
-    VALUE_180 = 180,
-    VALUE_181 = 181,
-    VALUE_182 = 182,
-    VALUE_183 = 183,
-    VALUE_184 = 184,
-    VALUE_185 = 185,
-    VALUE_186 = 186,
-    VALUE_187 = 187,
-    VALUE_188 = 188,
-    VALUE_189 = 189,
-    VALUE_190 = 190,
-    VALUE_191 = 191,
-    VALUE_192 = 192,
-    VALUE_193 = 193,
-    VALUE_194 = 194,
-    VALUE_195 = 195,
-    VALUE_196 = 196,
-    VALUE_197 = 197,
-    VALUE_198 = 198,
-    VALUE_199 = 199,
-    VALUE_200 = 200,
-    VALUE_201 = 201,
-    VALUE_202 = 202,
-    VALUE_203 = 203,
-    VALUE_204 = 204,
-    VALUE_205 = 205,
-    VALUE_206 = 206,
-    VALUE_207 = 207,
-    VALUE_208 = 208,
-    VALUE_209 = 209,
-    VALUE_210 = 210,
-    VALUE_211 = 211,
-    VALUE_212 = 212,
-    VALUE_213 = 213,
-    VALUE_214 = 214,
-    VALUE_215 = 215,
-    VALUE_216 = 216,
-    VALUE_217 = 217,
-    VALUE_218 = 218,
-    VALUE_219 = 219,
-    VALUE_220 = 220,
-    VALUE_221 = 221,
-    VALUE_222 = 222,
-    VALUE_223 = 223,
-    VALUE_224 = 224,
-    VALUE_225 = 225,
-    VALUE_226 = 226,
-    VALUE_227 = 227,
-    VALUE_228 = 228,
-    VALUE_229 = 229,
-    VALUE_230 = 230,
-    VALUE_231 = 231,
-    VALUE_232 = 232,
-    VALUE_233 = 233,
-    VALUE_234 = 234,
-    VALUE_235 = 235,
-    VALUE_236 = 236,
-    VALUE_237 = 237,
-    VALUE_238 = 238,
-    VALUE_239 = 239,
-    VALUE_240 = 240,
-    VALUE_241 = 241,
-    VALUE_242 = 242,
-    VALUE_243 = 243,
-    VALUE_244 = 244,
-    VALUE_245 = 245,
-    VALUE_246 = 246,
-    VALUE_247 = 247,
-    VALUE_248 = 248,
-    VALUE_249 = 249,
-    VALUE_250 = 250,
-    VALUE_251 = 251,
-    VALUE_252 = 252,
-    VALUE_253 = 253,
-    VALUE_254 = 254,
-    VALUE_255 = 255,
-    VALUE_256 = 256,
-    VALUE_257 = 257,
-    VALUE_258 = 258,
-    VALUE_259 = 259,
-    VALUE_260 = 260,
-    VALUE_261 = 261,
-    VALUE_262 = 262,
-    VALUE_263 = 263,
-    VALUE_264 = 264,
-    VALUE_265 = 265,
-    VALUE_266 = 266,
-    VALUE_267 = 267,
-    VALUE_268 = 268,
-    VALUE_269 = 269,
-    VALUE_270 = 270,
-    VALUE_271 = 271,
-    VALUE_272 = 272,
-    VALUE_273 = 273,
-    VALUE_274 = 274,
-    VALUE_275 = 275,
-    VALUE_276 = 276,
-    VALUE_277 = 277,
-    VALUE_278 = 278,
-    VALUE_279 = 279,
-    VALUE_280 = 280,
-    VALUE_281 = 281,
-    VALUE_282 = 282,
-    VALUE_283 = 283,
-    VALUE_284 = 284,
-    VALUE_285 = 285,
-    VALUE_286 = 286,
-    VALUE_287 = 287,
-    VALUE_288 = 288,
-    VALUE_289 = 289,
-    VALUE_290 = 290,
-    VALUE_291 = 291,
-    VALUE_292 = 292,
-    VALUE_293 = 293,
-    VALUE_294 = 294,
-    VALUE_295 = 295,
-    VALUE_296 = 296,
-    VALUE_297 = 297,
-    VALUE_298 = 298,
-    VALUE_299 = 299,
-    VALUE_300 = 300,
-    VALUE_301 = 301,
-    VALUE_302 = 302,
-    VALUE_303 = 303,
-    VALUE_304 = 304,
-    VALUE_305 = 305,
-    VALUE_306 = 306,
-    VALUE_307 = 307,
-    VALUE_308 = 308,
-    VALUE_309 = 309,
-    VALUE_310 = 310,
-    VALUE_311 = 311,
-    VALUE_312 = 312,
-    VALUE_313 = 313,
-    VALUE_314 = 314,
-    VALUE_315 = 315,
-    VALUE_316 = 316,
-    VALUE_317 = 317,
-    VALUE_318 = 318,
-    VALUE_319 = 319,
-    VALUE_320 = 320,
-    VALUE_321 = 321,
-    VALUE_322 = 322,
-    VALUE_323 = 323,
-    VALUE_324 = 324,
-    VALUE_325 = 325,
-    VALUE_326 = 326,
-    VALUE_327 = 327,
-    VALUE_328 = 328,
-    VALUE_329 = 329,
-    VALUE_330 = 330,
-    VALUE_331 = 331,
-    VALUE_332 = 332,
-    VALUE_333 = 333,
-    VALUE_334 = 334,
-    VALUE_335 = 335,
-    VALUE_336 = 336,
-    VALUE_337 = 337,
-    VALUE_338 = 338,
-    VALUE_339 = 339,
-    VALUE_340 = 340,
-    VALUE_341 = 341,
-    VALUE_342 = 342,
-    VALUE_343 = 343,
-    VALUE_344 = 344,
-    VALUE_345 = 345,
-    VALUE_346 = 346,
-    VALUE_347 = 347,
-    VALUE_348 = 348,
-    VALUE_349 = 349,
-    VALUE_350 = 350,
-    VALUE_351 = 351,
-    VALUE_352 = 352,
-    VALUE_353 = 353,
-    VALUE_354 = 354,
-    VALUE_355 = 355,
-    VALUE_356 = 356,
-    VALUE_357 = 357,
-    VALUE_358 = 358,
-    VALUE_359 = 359,
-    VALUE_360 = 360,
-    VALUE_361 = 361,
-    VALUE_362 = 362,
-    VALUE_363 = 363,
-    VALUE_364 = 364,
-    VALUE_365 = 365,
-    VALUE_366 = 366,
-    VALUE_367 = 367,
-    VALUE_368 = 368,
-    VALUE_369 = 369,
-    VALUE_370 = 370,
-    VALUE_371 = 371,
-    VALUE_372 = 372,
-    VALUE_373 = 373,
-    VALUE_374 = 374,
-    VALUE_375 = 375,
-    VALUE_376 = 376,
-    VALUE_377 = 377,
-    VALUE_378 = 378,
-    VALUE_379 = 379,
-    VALUE_380 = 380,
-    VALUE_381 = 381,
-    VALUE_382 = 382,
-    VALUE_383 = 383,
-    VALUE_384 = 384,
-    VALUE_385 = 385,
-    VALUE_386 = 386,
-    VALUE_387 = 387,
-    VALUE_388 = 388,
-    VALUE_389 = 389,
-    VALUE_390 = 390,
-    VALUE_391 = 391,
-    VALUE_392 = 392,
-    VALUE_393 = 393,
-    VALUE_394 = 394,
-    VALUE_395 = 395,
-    VALUE_396 = 396,
-    VALUE_397 = 397,
-    VALUE_398 = 398,
-    VALUE_399 = 399,
-    VALUE_400 = 400,
-    VALUE_401 = 401,
-    VALUE_402 = 402,
-    VALUE_403 = 403,
-    VALUE_404 = 404,
-    VALUE_405 = 405,
-    VALUE_406 = 406,
-    VALUE_407 = 407,
-    VALUE_408 = 408,
-    VALUE_409 = 409,
-    VALUE_410 = 410,
-    VALUE_411 = 411,
-    VALUE_412 = 412,
-    VALUE_413 = 413,
-    VALUE_414 = 414,
-    VALUE_415 = 415,
-    VALUE_416 = 416,
-    VALUE_417 = 417,
-    VALUE_418 = 418,
-    VALUE_419 = 419,
-    VALUE_420 = 420,
-    VALUE_421 = 421,
-    VALUE_422 = 422,
-    VALUE_423 = 423,
-    VALUE_424 = 424,
-    VALUE_425 = 425,
-    VALUE_426 = 426,
-    VALUE_427 = 427,
-    VALUE_428 = 428,
-    VALUE_429 = 429,
-    VALUE_430 = 430,
-    VALUE_431 = 431,
-    VALUE_432 = 432,
-    VALUE_433 = 433,
-    VALUE_434 = 434,
-    VALUE_435 = 435,
-    VALUE_436 = 436,
-    VALUE_437 = 437,
-    VALUE_438 = 438,
-    VALUE_439 = 439,
-    VALUE_440 = 440,
-    VALUE_441 = 441,
-    VALUE_442 = 442,
-    VALUE_443 = 443,
-    VALUE_444 = 444,
-    VALUE_445 = 445,
-    VALUE_446 = 446,
-    VALUE_447 = 447,
-    VALUE_448 = 448,
-    VALUE_449 = 449,
-    VALUE_450 = 450,
-    VALUE_451 = 451,
-    VALUE_452 = 452,
-    VALUE_453 = 453,
-    VALUE_454 = 454,
-    VALUE_455 = 455,
-    VALUE_456 = 456,
-    VALUE_457 = 457,
-    VALUE_458 = 458,
-    VALUE_459 = 459,
-    VALUE_460 = 460,
-    VALUE_461 = 461,
-    VALUE_462 = 462,
-    VALUE_463 = 463,
-    VALUE_464 = 464,
-    VALUE_465 = 465,
-    VALUE_466 = 466,
-    VALUE_467 = 467,
-    VALUE_468 = 468,
-    VALUE_469 = 469,
-    VALUE_470 = 470,
-    VALUE_471 = 471,
-    VALUE_472 = 472,
-    VALUE_473 = 473,
-    VALUE_474 = 474,
-    VALUE_475 = 475,
-    VALUE_476 = 476,
-    VALUE_477 = 477,
-    VALUE_478 = 478,
-    VALUE_479 = 479,
-    VALUE_480 = 480,
-    VALUE_481 = 481,
-    VALUE_482 = 482,
-    VALUE_483 = 483,
-    VALUE_484 = 484,
-    VALUE_485 = 485,
-    VALUE_486 = 486,
-    VALUE_487 = 487,
-    VALUE_488 = 488,
-    VALUE_489 = 489,
-    VALUE_490 = 490,
-    VALUE_491 = 491,
-    VALUE_492 = 492,
-    VALUE_493 = 493,
-    VALUE_494 = 494,
-    VALUE_495 = 495,
-    VALUE_496 = 496,
-    VALUE_497 = 497,
-    VALUE_498 = 498,
-    VALUE_499 = 499,
-    VALUE_500 = 500,
-    VALUE_501 = 501,
-    VALUE_502 = 502,
-    VALUE_503 = 503,
-    VALUE_504 = 504,
-    VALUE_505 = 505,
-    VALUE_506 = 506,
-    VALUE_507 = 507,
-    VALUE_508 = 508,
-    VALUE_509 = 509,
-    VALUE_510 = 510,
-    VALUE_511 = 511,
-    VALUE_512 = 512
-};
+#include <gtest/gtest.h>
 
 static_assert(EnumeratorTraits<ScopedEnum>::size() == 1025);
 
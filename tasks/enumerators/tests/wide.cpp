@@ -0,0 +1,77 @@
+#include <EnumeratorTraits.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+
+// Must compile in seconds, without any flags, on every compiler from the README
+
+enum class Wide : int {
+    MIN = -16384, NEGATIVE = -12345, MINUS_ONE = -1, ZERO, ONE,
+    BELOW_PAGE = 4095, PAGE = 4096, ODD = 9999, BELOW_MAX = 16383, MAX = 16384
+};
+
+static_assert(EnumeratorTraits<Wide, 16384>::size() == 10);
+static_assert(EnumeratorTraits<Wide, 16384>::at(0) == Wide::MIN);
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(0) == "MIN");
+static_assert(EnumeratorTraits<Wide, 16384>::at(1) == Wide::NEGATIVE);
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(2) == "MINUS_ONE");
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(3) == "ZERO");
+static_assert(EnumeratorTraits<Wide, 16384>::at(5) == Wide::BELOW_PAGE);
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(6) == "PAGE");
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(7) == "ODD");
+static_assert(EnumeratorTraits<Wide, 16384>::at(8) == Wide::BELOW_MAX);
+static_assert(EnumeratorTraits<Wide, 16384>::at(9) == Wide::MAX);
+static_assert(EnumeratorTraits<Wide, 16384>::nameAt(9) == "MAX");
+
+// Smaller MAXN only sees a part of the enum
+static_assert(EnumeratorTraits<Wide, 4095>::size() == 4);
+static_assert(EnumeratorTraits<Wide, 4095>::at(0) == Wide::MINUS_ONE);
+static_assert(EnumeratorTraits<Wide, 4095>::at(3) == Wide::BELOW_PAGE);
+
+// The underlying type clips the scan from below
+enum Port : std::uint16_t {
+    HTTP = 80, HTTPS = 443, ALT_HTTP = 8080, HIGH = 16000
+};
+
+static_assert(EnumeratorTraits<Port, 16384>::size() == 4);
+static_assert(EnumeratorTraits<Port, 16384>::nameAt(0) == "HTTP");
+static_assert(EnumeratorTraits<Port, 16384>::at(2) == ALT_HTTP);
+static_assert(EnumeratorTraits<Port, 16384>::nameAt(3) == "HIGH");
+
+
+// A declared range replaces [-MAXN, MAXN], even outside of it
+enum class Code : std::int64_t {
+    FIRST = 1'000'000, SECOND = 1'000'500, LAST = 1'001'000
+};
+
+template <>
+struct EnumeratorRange<Code> {
+    static constexpr std::int64_t min = 1'000'000;
+    static constexpr std::int64_t max = 1'001'000;
+};
+
+static_assert(EnumeratorTraits<Code>::size() == 3);
+static_assert(EnumeratorTraits<Code>::at(0) == Code::FIRST);
+static_assert(EnumeratorTraits<Code>::nameAt(1) == "SECOND");
+static_assert(EnumeratorTraits<Code>::at(2) == Code::LAST);
+
+// Enumerators out of the declared range are not seen even if |value| <= MAXN
+enum class Clipped {
+    OUTSIDE = -5, LOW = 10, INSIDE = 20, HIGH = 30, ABOVE = 40
+};
+
+template <>
+struct EnumeratorRange<Clipped> {
+    static constexpr int min = 10;
+    static constexpr int max = 30;
+};
+
+static_assert(EnumeratorTraits<Clipped>::size() == 3);
+static_assert(EnumeratorTraits<Clipped>::nameAt(0) == "LOW");
+static_assert(EnumeratorTraits<Clipped>::nameAt(2) == "HIGH");
+
+
+TEST(EnumeratorTest, Wide)
+{ }
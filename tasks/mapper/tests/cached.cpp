@@ -0,0 +1,235 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+using std::operator""sv;
+
+struct Animal {
+  virtual ~Animal() = default;
+};
+
+struct Cat : Animal {};
+struct Okayu : Cat {};
+
+struct Dog : Animal {};
+struct StBernard : Dog {};
+struct Chihuahua : Dog {};
+struct AngryChihuahua : Chihuahua {};
+
+struct Cow : Animal {};
+struct Fauna : Cow {};
+
+constexpr std::size_t kDepth = 48;
+constexpr std::size_t kStep = 8;
+constexpr std::size_t kWidth = 64;
+
+template <std::size_t depth>
+struct Deep : Deep<depth - 1> {};
+
+template <>
+struct Deep<0> : Animal {};
+
+template <std::size_t index>
+struct Wide : Animal {};
+
+
+template <class Mapper, class Plain, class... Ts>
+void expectSameAsPlain() {
+  ([]()
+  {
+    std::unique_ptr<Animal> animal{new Ts()};
+    MPC_REQUIRE(eq, Mapper::map(*animal), Plain::map(*animal));
+    // The second lookup is served from the cache
+    MPC_REQUIRE(eq, Mapper::map(*animal), Plain::map(*animal));
+  }(), ...);
+}
+
+TEST(CachedMapperTest, JustWorks)
+{
+  using MyMapper =
+    CachedPolymorphicMapper
+    < Animal, FixedString<256>
+    , Mapping<StBernard, "Baaark"_cstr>
+    , Mapping<Cat, "Meow"_cstr>
+    , Mapping<Dog, "Bark"_cstr>
+    >;
+
+  static_assert(std::is_same_v<decltype(MyMapper::map(std::declval<const Animal&>())),
+                               std::optional<FixedString<256>>>);
+
+  std::unique_ptr<Animal> okayu{new Okayu()};
+  std::unique_ptr<Animal> st_bernard{new StBernard()};
+  std::unique_ptr<Animal> chihuahua{new AngryChihuahua()};
+  std::unique_ptr<Animal> cow{new Cow()};
+
+  for (int i = 0; i < 3; ++i) {
+    MPC_REQUIRE(eq, *MyMapper::map(*okayu), "Meow"sv);
+    MPC_REQUIRE(eq, *MyMapper::map(*st_bernard), "Baaark"sv);
+    MPC_REQUIRE(eq, *MyMapper::map(*chihuahua), "Bark"sv);
+    MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+  }
+}
+
+TEST(CachedMapperTest, SameAsPlain)
+{
+  using Sorted = std::tuple
+    < Mapping<Okayu, 1>
+    , Mapping<Cat, 2>
+    , Mapping<AngryChihuahua, 3>
+    , Mapping<Dog, 4>
+    , Mapping<Cow, 5>
+    >;
+
+  [&]<class... Ms>(std::tuple<Ms...>*) {
+    expectSameAsPlain
+      < CachedPolymorphicMapper<Animal, int, Ms...>
+      , PolymorphicMapper<Animal, int, Ms...>
+      , Animal, Cat, Okayu, Dog, StBernard, Chihuahua, AngryChihuahua, Cow, Fauna
+      >();
+  }(static_cast<Sorted*>(nullptr));
+
+  expectSameAsPlain
+    < CachedPolymorphicMapper<Animal, int>
+    , PolymorphicMapper<Animal, int>
+    , Cat, Dog, Cow
+    >();
+}
+
+TEST(CachedMapperTest, OneEntryPerDynamicType)
+{
+  using MyMapper =
+    CachedPolymorphicMapper
+    < Animal, int
+    , Mapping<Cat, 1>
+    , Mapping<Dog, 2>
+    >;
+
+  std::unique_ptr<Animal> cat{new Cat()};
+  std::unique_ptr<Animal> okayu{new Okayu()};
+  std::unique_ptr<Animal> other_okayu{new Okayu()};
+  std::unique_ptr<Animal> cow{new Cow()};
+
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{0});
+
+  MPC_REQUIRE(eq, MyMapper::map(*okayu), 1);
+  MPC_REQUIRE(eq, MyMapper::map(*other_okayu), 1);
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{1});
+
+  MPC_REQUIRE(eq, MyMapper::map(*cat), 1);
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{2});
+
+  // Misses are cached as well
+  MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+  MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{3});
+
+  // Every mapper has its own cache
+  using OtherMapper = CachedPolymorphicMapper<Animal, int, Mapping<Cow, 3>>;
+  MPC_REQUIRE(eq, OtherMapper::cacheSize(), size_t{0});
+  MPC_REQUIRE(eq, OtherMapper::map(*cow), 3);
+  MPC_REQUIRE(eq, OtherMapper::cacheSize(), size_t{1});
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{3});
+}
+
+TEST(CachedMapperTest, DeepHierarchy)
+{
+  // Every kStep-th level is listed, the rest resolve to the nearest listed base
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    using MyMapper =
+      CachedPolymorphicMapper
+      < Animal, std::size_t
+      , Mapping<Deep<(kDepth / kStep - Is) * kStep>, (kDepth / kStep - Is) * kStep>...
+      >;
+
+    [&]<std::size_t... Levels>(std::index_sequence<Levels...>) {
+      for (int i = 0; i < 2; ++i) {
+        ([]()
+        {
+          std::unique_ptr<Animal> animal{new Deep<Levels>()};
+          MPC_REQUIRE(eq, MyMapper::map(*animal), Levels / kStep * kStep);
+        }(), ...);
+      }
+    }(std::make_index_sequence<kDepth + 1>{});
+
+    MPC_REQUIRE(eq, MyMapper::cacheSize(), kDepth + 1);
+  }(std::make_index_sequence<kDepth / kStep + 1>{});
+}
+
+TEST(CachedMapperTest, WideHierarchy)
+{
+  // The last one is not listed
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    using MyMapper =
+      CachedPolymorphicMapper
+      < Animal, std::size_t
+      , Mapping<Wide<Is>, Is>...
+      >;
+
+    for (int i = 0; i < 2; ++i) {
+      ([]()
+      {
+        std::unique_ptr<Animal> animal{new Wide<Is>()};
+        MPC_REQUIRE(eq, MyMapper::map(*animal), Is);
+      }(), ...);
+
+      std::unique_ptr<Animal> unlisted{new Wide<kWidth>()};
+      MPC_REQUIRE(nullopt, MyMapper::map(*unlisted));
+    }
+
+    MPC_REQUIRE(eq, MyMapper::cacheSize(), kWidth + 1);
+  }(std::make_index_sequence<kWidth>{});
+}
+
+TEST(CachedMapperTest, ConcurrentLookups)
+{
+  using MyMapper =
+    CachedPolymorphicMapper
+    < Animal, int
+    , Mapping<Okayu, 1>
+    , Mapping<Cat, 2>
+    , Mapping<Dog, 3>
+    >;
+
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 10'000;
+
+  std::vector<std::thread> threads;
+  std::vector<int> failures(kThreads, 0);
+
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t, &failures] {
+      Okayu okayu;
+      Cat cat;
+      StBernard st_bernard;
+      Cow cow;
+      const Animal* animals[] = {&okayu, &cat, &st_bernard, &cow};
+      const std::optional<int> expected[] = {1, 2, 3, std::nullopt};
+
+      for (int i = 0; i < kIterations; ++i) {
+        int k = (i + t) % 4;
+        if (MyMapper::map(*animals[k]) != expected[k]) {
+          ++failures[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kThreads; ++t) {
+    MPC_REQUIRE(eq, failures[t], 0);
+  }
+  MPC_REQUIRE(eq, MyMapper::cacheSize(), size_t{4});
+}
@@ -0,0 +1,74 @@
+#include <PolymorphicMapper.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// CachedPolymorphicMapper against the dynamic_cast chain of
+// PolymorphicMapper. On a deep hierarchy every cast walks a long chain of
+// bases, on a wide one a lookup tries up to all the mappings.
+
+struct Animal {
+  virtual ~Animal() = default;
+};
+
+constexpr std::size_t kDepth = 64;
+constexpr std::size_t kWidth = 128;
+constexpr std::size_t kObjects = 1 << 10;
+
+template <std::size_t depth>
+struct Deep : Deep<depth - 1> {};
+
+template <>
+struct Deep<0> : Animal {};
+
+template <std::size_t index>
+struct Wide : Animal {};
+
+// Derived classes go first, as PolymorphicMapper wants
+template <template <class, class, class...> class Mapper, std::size_t... Is>
+auto DeepMapper(std::index_sequence<Is...>)
+  -> Mapper<Animal, std::size_t, Mapping<Deep<kDepth - Is>, kDepth - Is>...>;
+
+template <template <class, class, class...> class Mapper, std::size_t... Is>
+auto WideMapper(std::index_sequence<Is...>) -> Mapper<Animal, std::size_t, Mapping<Wide<Is>, Is>...>;
+
+template <template <class, class, class...> class Mapper>
+using DeepMapperT = decltype(DeepMapper<Mapper>(std::make_index_sequence<kDepth + 1>{}));
+
+template <template <class, class, class...> class Mapper>
+using WideMapperT = decltype(WideMapper<Mapper>(std::make_index_sequence<kWidth>{}));
+
+// Objects of all the types of a hierarchy in random order
+template <template <std::size_t> class Node, std::size_t... Is>
+std::vector<std::unique_ptr<Animal>> MakeObjects(std::index_sequence<Is...>) {
+  std::vector<std::unique_ptr<Animal>> objects;
+  while (objects.size() < kObjects) {
+    (objects.push_back(std::make_unique<Node<Is>>()), ...);
+  }
+  std::shuffle(objects.begin(), objects.end(), std::mt19937{42});
+  return objects;
+}
+
+template <class Mapper, template <std::size_t> class Node, std::size_t count>
+void BM_Map(benchmark::State& state) {
+  auto objects = MakeObjects<Node>(std::make_index_sequence<count>{});
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& object : objects) {
+      sum += *Mapper::map(*object);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * objects.size());
+}
+
+BENCHMARK(BM_Map<DeepMapperT<PolymorphicMapper>, Deep, kDepth + 1>)->Name("BM_Deep/Plain");
+BENCHMARK(BM_Map<DeepMapperT<CachedPolymorphicMapper>, Deep, kDepth + 1>)->Name("BM_Deep/Cached");
+BENCHMARK(BM_Map<WideMapperT<PolymorphicMapper>, Wide, kWidth>)->Name("BM_Wide/Plain");
+BENCHMARK(BM_Map<WideMapperT<CachedPolymorphicMapper>, Wide, kWidth>)->Name("BM_Wide/Cached");
@@ -0,0 +1,71 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// A mapper over 1000 exceptions, as in the JNI story from the README, with
+// one of the three kinds of strings as its Target:
+//   STRINGS=cstr -- FixedString<256>, what ""_cstr gives;
+//   STRINGS=fstr -- FixedString of the exact length, what ""_fstr gives;
+//   STRINGS=sstr -- StaticString from intern, what ""_sstr gives.
+// The compile benchmark records time, memory and the object size for each.
+
+#ifndef STRINGS
+#define STRINGS cstr
+#endif
+
+#define BENCH_KIND(kind) BENCH_KIND_IMPL(kind)
+#define BENCH_KIND_IMPL(kind) BENCH_KIND_##kind
+#define BENCH_KIND_cstr 1
+#define BENCH_KIND_fstr 2
+#define BENCH_KIND_sstr 3
+
+constexpr std::size_t kMappings = 1000;
+
+struct Exception {
+  virtual ~Exception() = default;
+};
+
+template <std::size_t I>
+struct NumberedException : Exception {};
+
+// "java/lang/Exception0042" and the like, all of the same length
+constexpr std::size_t kNameLength = sizeof("java/lang/Exception0000") - 1;
+
+template <std::size_t maxLength, std::size_t I>
+constexpr FixedString<maxLength> MakeName() {
+  char name[] = "java/lang/Exception0000";
+  std::size_t number = I;
+  for (std::size_t i = kNameLength; i-- > kNameLength - 4; number /= 10) {
+    name[i] = static_cast<char>('0' + number % 10);
+  }
+  return FixedString<maxLength>(name, kNameLength);
+}
+
+#if BENCH_KIND(STRINGS) == BENCH_KIND_cstr
+using Target = FixedString<256>;
+template <std::size_t I>
+constexpr Target kName = MakeName<256, I>();
+#elif BENCH_KIND(STRINGS) == BENCH_KIND_fstr
+using Target = FixedString<kNameLength>;
+template <std::size_t I>
+constexpr Target kName = MakeName<kNameLength, I>();
+#elif BENCH_KIND(STRINGS) == BENCH_KIND_sstr
+using Target = StaticString;
+template <std::size_t I>
+constexpr Target kName = intern<MakeName<kNameLength, I>()>();
+#else
+#error "STRINGS must be one of cstr, fstr and sstr"
+#endif
+
+template <std::size_t... Is>
+auto MakeMapper(std::index_sequence<Is...>)
+  -> PolymorphicMapper<Exception, Target, Mapping<NumberedException<Is>, kName<Is>>...>;
+
+using Mapper = decltype(MakeMapper(std::make_index_sequence<kMappings>{}));
+
+std::optional<Target> Map(const Exception& exception) {
+  return Mapper::map(exception);
+}
@@ -0,0 +1,102 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+
+using std::operator""sv;
+
+StaticString otherMeow();
+StaticString otherInterned();
+
+static_assert(std::is_same_v<decltype("Meow"_fstr), FixedString<4>>);
+static_assert(std::is_same_v<decltype(""_fstr), FixedString<0>>);
+static_assert(std::is_trivially_copyable_v<FixedString<4>>);
+static_assert(sizeof(FixedString<4>) < sizeof(FixedString<256>));
+static_assert("Meow"_fstr == "Meow"sv);
+static_assert(""_fstr == ""sv);
+
+static_assert(std::is_trivially_copyable_v<StaticString>);
+static_assert(sizeof(StaticString) <= 2 * sizeof(void*));
+static_assert("Meow"_sstr == "Meow"sv);
+static_assert(""_sstr == ""sv);
+static_assert(std::string_view{intern<"Bark"_fstr>()} == "Bark"sv);
+
+// Equal strings are stored once
+static_assert("Meow"_sstr == "Meow"_sstr);
+static_assert("Meow"_sstr == intern<"Meow"_fstr>());
+static_assert("Meow"_sstr == intern<FixedString<4>{"Meow", 4}>());
+static_assert("Meow"_sstr != "Bark"_sstr);
+
+class Animal {
+public:
+  virtual ~Animal() = default;
+};
+
+class Cat : public Animal {};
+class Dog : public Animal {};
+class StBernard : public Dog {};
+class Cow : public Animal {};
+
+TEST(InternedTest, SharedStorage)
+{
+  StaticString meow = "Meow"_sstr;
+  MPC_REQUIRE(eq, std::string_view{meow}.data(), std::string_view{otherMeow()}.data());
+  MPC_REQUIRE(eq, meow, otherMeow());
+  MPC_REQUIRE(eq, std::string_view{otherMeow()}, "Meow"sv);
+
+  MPC_REQUIRE(eq, std::string_view{"Interned"_sstr}.data(), std::string_view{otherInterned()}.data());
+  MPC_REQUIRE(eq, std::string_view{otherInterned()}, "Interned"sv);
+
+  std::string_view first = "Meow"_sstr;
+  std::string_view second = intern<"Meow"_fstr>();
+  MPC_REQUIRE(eq, first.data(), second.data());
+}
+
+TEST(InternedTest, ExactLengthMappings)
+{
+  using MyMapper =
+    PolymorphicMapper
+    < Animal, FixedString<4>
+    , Mapping<Cat, "Meow"_fstr>
+    , Mapping<Dog, "Bark"_fstr>
+    >;
+
+  std::unique_ptr<Animal> cat{new Cat()};
+  std::unique_ptr<Animal> cow{new Cow()};
+
+  MPC_REQUIRE(eq, *MyMapper::map(*cat), "Meow"sv);
+  MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+}
+
+TEST(InternedTest, InternedMappings)
+{
+  using MyMapper =
+    PolymorphicMapper
+    < Animal, StaticString
+    , Mapping<StBernard, "Baaark"_sstr>
+    , Mapping<Cat, "Meow"_sstr>
+    , Mapping<Dog, "Bark"_sstr>
+    >;
+
+  std::unique_ptr<Animal> cat{new Cat()};
+  std::unique_ptr<Animal> dog{new Dog()};
+  std::unique_ptr<Animal> st_bernard{new StBernard()};
+  std::unique_ptr<Animal> cow{new Cow()};
+
+  MPC_REQUIRE(eq, std::string_view{*MyMapper::map(*st_bernard)}, "Baaark"sv);
+  MPC_REQUIRE(eq, std::string_view{*MyMapper::map(*dog)}, "Bark"sv);
+  MPC_REQUIRE(eq, std::string_view{*MyMapper::map(*cat)}.data(), std::string_view{otherMeow()}.data());
+  MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+
+  // All the mappers referring to the same string share it
+  using OtherMapper = PolymorphicMapper<Animal, StaticString, Mapping<Cat, "Meow"_sstr>>;
+  MPC_REQUIRE(eq, *OtherMapper::map(*cat), *MyMapper::map(*cat));
+}
@@ -0,0 +1,43 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+
+// StaticString as the Target of the tree and the reverse mappers: needs
+// those bonuses solved as well, so it is not a part of `interned`
+
+class Animal {
+public:
+  virtual ~Animal() = default;
+};
+
+class Cat : public Animal {};
+class Dog : public Animal {};
+class StBernard : public Dog {};
+
+using MyMapper =
+  PolymorphicMapper
+  < Animal, StaticString
+  , Mapping<StBernard, "Baaark"_sstr>
+  , Mapping<Cat, "Meow"_sstr>
+  , Mapping<Dog, "Bark"_sstr>
+  >;
+
+TEST(InternedTest, OtherModes)
+{
+  std::unique_ptr<Animal> cat{new Cat()};
+
+  using Tree = TreePolymorphicMapper<Animal, StaticString, Mapping<Cat, "Meow"_sstr>>;
+  MPC_REQUIRE(eq, std::string_view{*Tree::map(*cat)}.data(), std::string_view{*MyMapper::map(*cat)}.data());
+
+  using Reverse = ReverseMapper<MyMapper>;
+  static_assert(Reverse::indexOf("Meow") == 1);
+  std::unique_ptr<Animal> made = Reverse::make("Baaark");
+  MPC_REQUIRE(true, dynamic_cast<StBernard*>(made.get()) != nullptr);
+}
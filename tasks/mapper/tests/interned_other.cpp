@@ -0,0 +1,11 @@
+#include <FixedString.hpp>
+
+// Lives in a separate translation unit on purpose: interned strings
+// must be shared by the whole program, not just by a single file
+StaticString otherMeow() {
+  return "Meow"_sstr;
+}
+
+StaticString otherInterned() {
+  return intern<"Interned"_fstr>();
+}
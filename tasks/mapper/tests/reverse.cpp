@@ -0,0 +1,149 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+using std::operator""sv;
+
+struct Animal {
+  virtual ~Animal() = default;
+  virtual std::string_view sound() const = 0;
+};
+
+struct Cat : Animal {
+  std::string_view sound() const override { return "Meow"; }
+};
+
+struct Dog : Animal {
+  std::string_view sound() const override { return "Bark"; }
+};
+
+struct StBernard : Dog {
+  std::string_view sound() const override { return "Baaark"; }
+};
+
+struct Cow : Animal {
+  explicit Cow(int) {}
+  std::string_view sound() const override { return "Moo"; }
+};
+
+using MyMapper =
+  PolymorphicMapper
+  < Animal, FixedString<256>
+  , Mapping<StBernard, "java/lang/StBernard"_cstr>
+  , Mapping<Cat, "java/lang/Cat"_cstr>
+  , Mapping<Dog, "java/lang/Dog"_cstr>
+  >;
+
+using MyReverse = ReverseMapper<MyMapper>;
+
+// The whole lookup is available in compile time
+static_assert(MyReverse::indexOf("java/lang/StBernard") == 0);
+static_assert(MyReverse::indexOf("java/lang/Cat") == 1);
+static_assert(MyReverse::indexOf("java/lang/Dog") == 2);
+static_assert(!MyReverse::indexOf("java/lang/Cow").has_value());
+static_assert(*MyReverse::find("java/lang/Dog") == "java/lang/Dog"sv);
+static_assert(std::is_same_v<decltype(MyReverse::find(""sv)), std::optional<FixedString<256>>>);
+
+// Node<i> is named "Node<i>"
+template <std::size_t index>
+struct Node : Animal {
+  std::string_view sound() const override { return "..."; }
+};
+
+constexpr FixedString<256> nodeName(std::size_t index) {
+  char buffer[32] = {'N', 'o', 'd', 'e', '<'};
+  std::size_t length = 5;
+  char digits[20];
+  std::size_t count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + index % 10);
+    index /= 10;
+  } while (index != 0);
+  while (count != 0) {
+    buffer[length++] = digits[--count];
+  }
+  buffer[length++] = '>';
+  return FixedString<256>{buffer, length};
+}
+
+
+TEST(ReverseMapperTest, JustWorks)
+{
+  MPC_REQUIRE(eq, MyReverse::indexOf("java/lang/Cat"), size_t{1});
+  MPC_REQUIRE(eq, *MyReverse::find("java/lang/StBernard"), "java/lang/StBernard"sv);
+
+  MPC_REQUIRE(nullopt, MyReverse::indexOf(""));
+  MPC_REQUIRE(nullopt, MyReverse::indexOf("java/lang/Ca"));
+  MPC_REQUIRE(nullopt, MyReverse::indexOf("java/lang/Catt"));
+  MPC_REQUIRE(nullopt, MyReverse::indexOf("java/lang/cat"));
+  MPC_REQUIRE(nullopt, MyReverse::find("java/lang/Cow"));
+
+  std::unique_ptr<Animal> dog = MyReverse::make("java/lang/Dog");
+  MPC_REQUIRE(true, dog != nullptr);
+  MPC_REQUIRE(eq, dog->sound(), "Bark"sv);
+  MPC_REQUIRE(eq, *MyMapper::map(*dog), "java/lang/Dog"sv);
+
+  std::unique_ptr<Animal> st_bernard = MyReverse::make("java/lang/StBernard");
+  MPC_REQUIRE(eq, st_bernard->sound(), "Baaark"sv);
+
+  MPC_REQUIRE(true, MyReverse::make("java/lang/Cow") == nullptr);
+}
+
+template <class Reverse>
+concept CanMake = requires (std::string_view name) {
+  Reverse::make(name);
+};
+
+TEST(ReverseMapperTest, Factories)
+{
+  // Cow is not default constructible, so there is no factory for it...
+  using WithCow = ReverseMapper<PolymorphicMapper<Animal, FixedString<256>, Mapping<Cow, "Cow"_cstr>>>;
+  static_assert(!CanMake<WithCow>);
+  static_assert(CanMake<MyReverse>);
+
+  // ...but names are still looked up
+  MPC_REQUIRE(eq, WithCow::indexOf("Cow"), size_t{0});
+
+  using Empty = ReverseMapper<PolymorphicMapper<Animal, FixedString<256>>>;
+  MPC_REQUIRE(nullopt, Empty::indexOf("Cow"));
+  MPC_REQUIRE(true, Empty::make("Cow") == nullptr);
+}
+
+TEST(ReverseMapperTest, ManyNames)
+{
+  constexpr std::size_t kNodes = 256;
+
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    using Reverse =
+      ReverseMapper<PolymorphicMapper
+      < Animal, FixedString<256>
+      , Mapping<Node<Is>, nodeName(Is)>...
+      >>;
+
+    static_assert(Reverse::indexOf("Node<0>") == 0);
+    static_assert(Reverse::indexOf("Node<255>") == 255);
+
+    ([]()
+    {
+      constexpr FixedString<256> name = nodeName(Is);
+      MPC_REQUIRE(eq, Reverse::indexOf(name), Is);
+
+      std::unique_ptr<Animal> node = Reverse::make(name);
+      MPC_REQUIRE(true, dynamic_cast<Node<Is>*>(node.get()) != nullptr);
+    }(), ...);
+
+    MPC_REQUIRE(nullopt, Reverse::indexOf("Node<256>"));
+    MPC_REQUIRE(nullopt, Reverse::indexOf("Node<>"));
+    MPC_REQUIRE(nullopt, Reverse::indexOf("Node<01>"));
+  }(std::make_index_sequence<kNodes>{});
+}
@@ -0,0 +1,40 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+
+// ReverseMapper over the cached and the tree mappers: needs those bonuses
+// solved as well, so it is not a part of `reverse`
+
+using std::operator""sv;
+
+struct Animal {
+  virtual ~Animal() = default;
+  virtual std::string_view sound() const = 0;
+};
+
+struct Cat : Animal {
+  std::string_view sound() const override { return "Meow"; }
+};
+
+struct Dog : Animal {
+  std::string_view sound() const override { return "Bark"; }
+};
+
+TEST(ReverseMapperTest, OtherModes)
+{
+  using Cached =
+    ReverseMapper<CachedPolymorphicMapper<Animal, FixedString<256>, Mapping<Cat, "Cat"_cstr>, Mapping<Dog, "Dog"_cstr>>>;
+  using Tree =
+    ReverseMapper<TreePolymorphicMapper<Animal, FixedString<256>, Mapping<Cat, "Cat"_cstr>, Mapping<Dog, "Dog"_cstr>>>;
+
+  static_assert(Cached::indexOf("Dog") == 1);
+  static_assert(Tree::indexOf("Cat") == 0);
+  MPC_REQUIRE(eq, Tree::make("Cat")->sound(), "Meow"sv);
+}
@@ -0,0 +1,222 @@
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+using std::operator""sv;
+
+struct Animal {
+  virtual ~Animal() = default;
+};
+
+struct Cat : Animal {};
+struct Okayu : Cat {};
+
+struct Dog : Animal {};
+struct CavalierKingCharlesSpaniel : Dog {};
+struct Korone : CavalierKingCharlesSpaniel {};
+
+struct StBernard : Dog {};
+struct Chihuahua : Dog {};
+struct SleepingChihuahua : Chihuahua {};
+struct AngryChihuahua : Chihuahua {};
+
+struct Cow : Animal {};
+struct Fauna : Cow {};
+
+struct Horse : Animal {};
+struct RaceHorse : Horse {};
+
+// Node<i> derives from Node<(i - 1) / 3>: a ternary tree of kNodes classes
+constexpr std::size_t kNodes = 200;
+constexpr std::size_t kArity = 3;
+
+template <std::size_t index>
+struct Node : Node<(index - 1) / kArity> {};
+
+template <>
+struct Node<0> : Animal {};
+
+// Not listed, resolves to its base
+template <std::size_t index>
+struct Leaf : Node<index> {};
+
+// A permutation of [0, kNodes), so that bases and descendants are mixed up
+constexpr std::size_t shuffled(std::size_t i) {
+  return i * 7 % kNodes;
+}
+
+
+template<class... Ts, size_t... Is>
+void testImpl(std::index_sequence<Is...>)
+{
+  using MyMapper =
+    TreePolymorphicMapper
+    < Animal, size_t
+    , Mapping<Ts, Is>...
+    >;
+
+  ([]()
+  {
+    std::unique_ptr<Animal> animal{new Ts()};
+    MPC_REQUIRE(eq, MyMapper::map(*animal), Is);
+  }(), ...);
+}
+
+template<class... Ts>
+void runTest() {
+  testImpl<Ts...>(std::make_index_sequence<sizeof...(Ts)>{});
+}
+
+TEST(TreeMapperTest, JustWorks)
+{
+  using MyMapper =
+    TreePolymorphicMapper
+    < Animal, FixedString<256>
+    , Mapping<Cat, "Meow"_cstr>
+    , Mapping<Dog, "Bark"_cstr>
+    , Mapping<StBernard, "Baaark"_cstr>
+    , Mapping<Horse, "Neigh"_cstr>
+    >;
+
+  static_assert(std::is_same_v<decltype(MyMapper::map(std::declval<const Animal&>())),
+                               std::optional<FixedString<256>>>);
+
+  std::unique_ptr<Animal> dog{new Dog()};
+  std::unique_ptr<Animal> st_bernard{new StBernard()};
+  std::unique_ptr<Animal> chihuahua{new AngryChihuahua()};
+  std::unique_ptr<Animal> cow{new Cow()};
+  std::unique_ptr<Animal> okayu{new Okayu()};
+  std::unique_ptr<Animal> race_horse{new RaceHorse()};
+
+  MPC_REQUIRE(nullopt, MyMapper::map(*cow));
+  MPC_REQUIRE(eq, *MyMapper::map(*okayu), "Meow"sv);
+  MPC_REQUIRE(eq, *MyMapper::map(*dog), "Bark"sv);
+  MPC_REQUIRE(eq, *MyMapper::map(*chihuahua), "Bark"sv);
+  MPC_REQUIRE(eq, *MyMapper::map(*st_bernard), "Baaark"sv);
+  MPC_REQUIRE(eq, *MyMapper::map(*race_horse), "Neigh"sv);
+
+  using EmptyMapper = TreePolymorphicMapper<Animal, int>;
+  MPC_REQUIRE(nullopt, EmptyMapper::map(*dog));
+}
+
+TEST(TreeMapperTest, AnyOrder)
+{
+  runTest
+    < Dog
+    , Korone
+    >();
+
+  runTest
+    < Korone
+    , CavalierKingCharlesSpaniel
+    , Dog
+    >();
+
+  runTest
+    < Dog
+    , RaceHorse
+    , Okayu
+    , Cat
+    , CavalierKingCharlesSpaniel
+    , AngryChihuahua
+    , Chihuahua
+    , StBernard
+    , SleepingChihuahua
+    , Horse
+    , Korone
+    , Cow
+    , Fauna
+    >();
+
+  runTest
+    < StBernard
+    , RaceHorse
+    , Chihuahua
+    , Fauna
+    , Okayu
+    , SleepingChihuahua
+    , CavalierKingCharlesSpaniel
+    , Cow
+    , Korone
+    , Horse
+    , AngryChihuahua
+    , Dog
+    , Cat
+    >();
+}
+
+TEST(TreeMapperTest, MaxCasts)
+{
+  static_assert(TreePolymorphicMapper<Animal, int>::kMaxCasts == 0);
+
+  // A chain is descended one cast per level
+  static_assert(TreePolymorphicMapper
+    < Animal, int
+    , Mapping<Korone, 1>
+    , Mapping<Dog, 2>
+    , Mapping<CavalierKingCharlesSpaniel, 3>
+    >::kMaxCasts == 3);
+
+  // Siblings are tried one by one
+  static_assert(TreePolymorphicMapper
+    < Animal, int
+    , Mapping<Cat, 1>
+    , Mapping<Dog, 2>
+    , Mapping<Cow, 3>
+    , Mapping<Horse, 4>
+    >::kMaxCasts == 4);
+
+  // 4 roots, then 3 children of Dog, then 2 children of Chihuahua
+  static_assert(TreePolymorphicMapper
+    < Animal, int
+    , Mapping<SleepingChihuahua, 1>
+    , Mapping<Okayu, 2>
+    , Mapping<Cat, 3>
+    , Mapping<Horse, 4>
+    , Mapping<CavalierKingCharlesSpaniel, 5>
+    , Mapping<Chihuahua, 6>
+    , Mapping<Fauna, 7>
+    , Mapping<Dog, 8>
+    , Mapping<Korone, 9>
+    , Mapping<StBernard, 10>
+    , Mapping<AngryChihuahua, 11>
+    , Mapping<RaceHorse, 12>
+    , Mapping<Cow, 13>
+    >::kMaxCasts == 9);
+}
+
+TEST(TreeMapperTest, Stress)
+{
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    using MyMapper =
+      TreePolymorphicMapper
+      < Animal, std::size_t
+      , Mapping<Node<shuffled(Is)>, shuffled(Is)>...
+      >;
+
+    // A ternary tree of 200 nodes is 5 levels deep below the root
+    static_assert(MyMapper::kMaxCasts == 1 + 5 * kArity);
+
+    ([]()
+    {
+      std::unique_ptr<Animal> node{new Node<Is>()};
+      MPC_REQUIRE(eq, MyMapper::map(*node), Is);
+
+      std::unique_ptr<Animal> leaf{new Leaf<Is>()};
+      MPC_REQUIRE(eq, MyMapper::map(*leaf), Is);
+    }(), ...);
+
+    std::unique_ptr<Animal> cat{new Cat()};
+    MPC_REQUIRE(nullopt, MyMapper::map(*cat));
+  }(std::make_index_sequence<kNodes>{});
+}
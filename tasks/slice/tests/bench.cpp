@@ -0,0 +1,74 @@
+#include <Slice.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+// One channel of an RGBA picture: every fourth float. A static stride is
+// what lets the compiler (or the bulk kernels) do better than the loop
+// with a runtime one, the raw loop is the baseline.
+
+constexpr std::size_t kChannels = 4;
+
+std::vector<float> MakePixels(std::size_t pixels) {
+  std::vector<float> data(pixels * kChannels);
+  std::iota(data.begin(), data.end(), 0.f);
+  return data;
+}
+
+void BM_Pointer(benchmark::State& state) {
+  auto data = MakePixels(state.range(0));
+  for (auto _ : state) {
+    float sum = 0;
+    for (std::size_t i = 0; i < data.size(); i += kChannels) {
+      sum += data[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Pointer)->Range(1 << 8, 1 << 20);
+
+void BM_StaticStride(benchmark::State& state) {
+  auto data = MakePixels(state.range(0));
+  for (auto _ : state) {
+    auto channel = Slice<const float>(data).Skip<kChannels>();
+    float sum = 0;
+    for (float x : channel) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StaticStride)->Range(1 << 8, 1 << 20);
+
+void BM_DynamicStride(benchmark::State& state) {
+  auto data = MakePixels(state.range(0));
+  for (auto _ : state) {
+    auto channel = Slice<const float>(data).Skip(kChannels);
+    float sum = 0;
+    for (float x : channel) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicStride)->Range(1 << 8, 1 << 20);
+
+void BM_StaticStrideIndex(benchmark::State& state) {
+  auto data = MakePixels(state.range(0));
+  for (auto _ : state) {
+    auto channel = Slice<const float>(data).Skip<kChannels>();
+    float sum = 0;
+    for (std::size_t i = 0; i < channel.Size(); ++i) {
+      sum += channel[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StaticStrideIndex)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,234 @@
+#include <Slice.hpp>
+#include <SliceAlgorithms.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace {
+
+constexpr std::array kSizes{0u, 1u, 2u, 3u, 7u, 8u, 9u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 1000u, 1023u};
+
+// Exactly enough memory for `size` elements with a given stride, so that
+// sanitizers catch any access past the last element of the slice.
+template <class T>
+std::vector<T> makeBuffer(std::size_t size, std::ptrdiff_t stride) {
+  std::vector<T> buffer(size == 0 ? 0 : (size - 1) * stride + 1);
+  for (std::size_t i = 0; i < buffer.size(); ++i)
+    buffer[i] = static_cast<T>(i % 100);
+  return buffer;
+}
+
+template <class T>
+void expectGapsUntouched(const std::vector<T>& buffer, std::ptrdiff_t stride) {
+  for (std::size_t i = 0; i < buffer.size(); ++i) {
+    if (i % stride != 0) {
+      EXPECT_EQ(buffer[i], static_cast<T>(i % 100)) << "index " << i << ", stride " << stride;
+    }
+  }
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkCopyTo(std::size_t size, std::ptrdiff_t runtimeStride) {
+  auto buffer = makeBuffer<T>(size, runtimeStride);
+  Slice<const T, extent, stride> slice(buffer.data(), buffer.size(), runtimeStride);
+  ASSERT_EQ(slice.Size(), size);
+
+  std::vector<T> out(size + 1, T{42});
+  CopyTo(slice, std::span<T>(out));
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(out[i], slice[i]) << "index " << i << ", stride " << runtimeStride;
+  EXPECT_EQ(out[size], T{42});
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkCopyFrom(std::size_t size, std::ptrdiff_t runtimeStride) {
+  auto buffer = makeBuffer<T>(size, runtimeStride);
+  Slice<T, extent, stride> slice(buffer.data(), buffer.size(), runtimeStride);
+
+  std::vector<T> in(size + 1);
+  for (std::size_t i = 0; i < in.size(); ++i)
+    in[i] = static_cast<T>(100 + i % 100);
+  CopyFrom(std::span<const T>(in), slice);
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(slice[i], in[i]) << "index " << i << ", stride " << runtimeStride;
+  expectGapsUntouched(buffer, runtimeStride);
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkFill(std::size_t size, std::ptrdiff_t runtimeStride) {
+  auto buffer = makeBuffer<T>(size, runtimeStride);
+  Slice<T, extent, stride> slice(buffer.data(), buffer.size(), runtimeStride);
+
+  Fill(slice, T{123});
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(slice[i], T{123}) << "index " << i << ", stride " << runtimeStride;
+  expectGapsUntouched(buffer, runtimeStride);
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkTransform(std::size_t size, std::ptrdiff_t runtimeStride) {
+  auto buffer = makeBuffer<T>(size, runtimeStride);
+  const auto original = buffer;
+  Slice<T, extent, stride> slice(buffer.data(), buffer.size(), runtimeStride);
+
+  Transform(slice, [](T x) { return static_cast<T>(x * 2 + 1); });
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(slice[i], static_cast<T>(original[i * runtimeStride] * 2 + 1))
+      << "index " << i << ", stride " << runtimeStride;
+  expectGapsUntouched(buffer, runtimeStride);
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkReduce(std::size_t size, std::ptrdiff_t runtimeStride) {
+  auto buffer = makeBuffer<T>(size, runtimeStride);
+  Slice<const T, extent, stride> slice(buffer.data(), buffer.size(), runtimeStride);
+
+  // All partial sums are small integers, so floating point sums are exact in any order
+  std::int64_t expected = 0;
+  for (std::size_t i = 0; i < size; ++i)
+    expected += static_cast<std::int64_t>(slice[i]);
+
+  EXPECT_EQ(Reduce(slice, std::int64_t{0}), expected) << "stride " << runtimeStride;
+  EXPECT_EQ(Reduce(slice, std::int64_t{7}), expected + 7) << "stride " << runtimeStride;
+
+  std::size_t count = Reduce(slice, std::size_t{0}, [](std::size_t acc, T) { return acc + 1; });
+  EXPECT_EQ(count, size);
+}
+
+template <class T, std::size_t extent, std::ptrdiff_t stride>
+void checkAll(std::size_t size, std::ptrdiff_t runtimeStride) {
+  checkCopyTo<T, extent, stride>(size, runtimeStride);
+  checkCopyFrom<T, extent, stride>(size, runtimeStride);
+  checkFill<T, extent, stride>(size, runtimeStride);
+  checkTransform<T, extent, stride>(size, runtimeStride);
+  checkReduce<T, extent, stride>(size, runtimeStride);
+}
+
+template <class T, std::ptrdiff_t stride>
+void checkStaticStride() {
+  for (std::size_t size : kSizes)
+    checkAll<T, std::dynamic_extent, stride>(size, stride);
+
+  checkAll<T, 0, stride>(0, stride);
+  checkAll<T, 5, stride>(5, stride);
+  checkAll<T, 37, stride>(37, stride);
+  checkAll<T, 64, stride>(64, stride);
+}
+
+template <class T>
+void checkDynamicStride() {
+  for (std::ptrdiff_t stride : {1, 2, 3, 4, 5, 8, 17})
+    for (std::size_t size : kSizes)
+      checkAll<T, std::dynamic_extent, dynamic_stride>(size, stride);
+
+  for (std::ptrdiff_t stride : {1, 3, 4})
+    checkAll<T, 37, dynamic_stride>(37, stride);
+}
+
+template <class T>
+void checkType() {
+  checkStaticStride<T, 1>();
+  checkStaticStride<T, 2>();
+  checkStaticStride<T, 3>();
+  checkStaticStride<T, 4>();
+  checkStaticStride<T, 5>();
+  checkStaticStride<T, 8>();
+  checkDynamicStride<T>();
+}
+
+struct Pixel {
+  std::uint8_t r, g, b, a;
+};
+
+}  // namespace
+
+TEST(SliceBulkTests, Float) {
+  checkType<float>();
+}
+
+TEST(SliceBulkTests, Double) {
+  checkType<double>();
+}
+
+TEST(SliceBulkTests, Int32) {
+  checkType<std::int32_t>();
+}
+
+TEST(SliceBulkTests, Int64) {
+  checkType<std::int64_t>();
+}
+
+TEST(SliceBulkTests, Bytes) {
+  checkType<std::uint8_t>();
+}
+
+TEST(SliceBulkTests, Channels) {
+  std::vector<float> rgba(4 * 100);
+  for (std::size_t i = 0; i < rgba.size(); ++i)
+    rgba[i] = static_cast<float>(i % 4);
+
+  for (std::size_t channel = 0; channel < 4; ++channel) {
+    Slice<float, std::dynamic_extent, 4> slice(rgba.data() + channel, rgba.size() - channel, 4);
+    ASSERT_EQ(slice.Size(), 100u);
+
+    std::vector<float> out(slice.Size());
+    CopyTo(slice, std::span<float>(out));
+    EXPECT_EQ(out, std::vector<float>(100, static_cast<float>(channel)));
+    EXPECT_EQ(Reduce(slice, 0.f), 100.f * channel);
+  }
+
+  Slice<float, 100, 4> alpha(rgba.data() + 3, rgba.size() - 3, 4);
+  Fill(alpha, 1.f);
+  for (std::size_t i = 0; i < rgba.size(); ++i)
+    EXPECT_EQ(rgba[i], i % 4 == 3 ? 1.f : static_cast<float>(i % 4));
+}
+
+TEST(SliceBulkTests, NonArithmetic) {
+  std::vector<Pixel> pixels(33, Pixel{1, 2, 3, 4});
+  Slice<Pixel, std::dynamic_extent, 2> even(pixels.data(), pixels.size(), 2);
+
+  Transform(even, [](Pixel p) { return Pixel{p.a, p.b, p.g, p.r}; });
+  for (std::size_t i = 0; i < pixels.size(); ++i)
+    EXPECT_EQ(pixels[i].r, i % 2 == 0 ? 4 : 1);
+
+  int sum = Reduce(even, 0, [](int acc, const Pixel& p) { return acc + p.r; });
+  EXPECT_EQ(sum, 4 * 17);
+}
+
+TEST(SliceBulkTests, RuntimeChecks) {
+  std::vector<int> vec(10);
+  Slice<int, std::dynamic_extent, 2> slice(vec.data(), vec.size(), 2);
+  std::vector<int> small(4);
+  std::vector<int> enough(5);
+
+  EXPECT_RUNTIME_FAIL(({
+    CopyTo(slice, std::span<int>(small));
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    CopyTo(slice, std::span<int>(enough));
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    CopyFrom(std::span<const int>(small), slice);
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    CopyFrom(std::span<const int>(enough), slice);
+  }));
+
+  Slice<int> empty{(int*)nullptr, 0u};
+  EXPECT_RUNTIME_OK(({
+    Fill(empty, 1);
+    Transform(empty, [](int x) { return x; });
+    CopyTo(empty, std::span<int>{});
+    CopyFrom(std::span<const int>{}, empty);
+  }));
+  EXPECT_EQ(Reduce(empty, 42), 42);
+}
@@ -0,0 +1,122 @@
+#include <Slice.hpp>
+#include <SliceAlgorithms.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <vector>
+
+// The bulk operations against the range-for loop they replace, for the
+// static strides that should get SIMD paths and for a runtime one
+
+constexpr std::ptrdiff_t kRuntimeStride = 3;
+
+template <std::ptrdiff_t stride>
+auto MakeSlice(std::vector<float>& data) {
+  if constexpr (stride == dynamic_stride) {
+    return Slice<float>(data).Skip(kRuntimeStride);
+  } else {
+    return Slice<float>(data).template Skip<stride>();
+  }
+}
+
+std::vector<float> MakeData(std::size_t size, std::ptrdiff_t stride) {
+  std::vector<float> data(size * (stride == dynamic_stride ? kRuntimeStride : stride));
+  std::iota(data.begin(), data.end(), 0.f);
+  return data;
+}
+
+template <std::ptrdiff_t stride>
+void BM_LoopSum(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  for (auto _ : state) {
+    float sum = 0;
+    for (float x : slice) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::ptrdiff_t stride>
+void BM_Reduce(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Reduce(slice, 0.f));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::ptrdiff_t stride>
+void BM_LoopCopy(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  std::vector<float> out(slice.Size());
+  for (auto _ : state) {
+    float* to = out.data();
+    for (float x : slice) {
+      *to++ = x;
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::ptrdiff_t stride>
+void BM_CopyTo(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  std::vector<float> out(slice.Size());
+  for (auto _ : state) {
+    CopyTo(slice, std::span<float>(out));
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::ptrdiff_t stride>
+void BM_LoopFill(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  for (auto _ : state) {
+    for (float& x : slice) {
+      x = 1.f;
+    }
+    benchmark::DoNotOptimize(data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::ptrdiff_t stride>
+void BM_Fill(benchmark::State& state) {
+  auto data = MakeData(state.range(0), stride);
+  auto slice = MakeSlice<stride>(data);
+  for (auto _ : state) {
+    Fill(slice, 1.f);
+    benchmark::DoNotOptimize(data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define BULK_BENCHMARKS(STRIDE) \
+  BENCHMARK(BM_LoopSum<STRIDE>)->Range(1 << 8, 1 << 18); \
+  BENCHMARK(BM_Reduce<STRIDE>)->Range(1 << 8, 1 << 18); \
+  BENCHMARK(BM_LoopCopy<STRIDE>)->Range(1 << 8, 1 << 18); \
+  BENCHMARK(BM_CopyTo<STRIDE>)->Range(1 << 8, 1 << 18); \
+  BENCHMARK(BM_LoopFill<STRIDE>)->Range(1 << 8, 1 << 18); \
+  BENCHMARK(BM_Fill<STRIDE>)->Range(1 << 8, 1 << 18)
+
+BULK_BENCHMARKS(1);
+BULK_BENCHMARKS(2);
+BULK_BENCHMARKS(3);
+BULK_BENCHMARKS(4);
+BULK_BENCHMARKS(dynamic_stride);
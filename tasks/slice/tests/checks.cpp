@@ -0,0 +1,93 @@
+#include <Slice.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+
+EXPECT_STATIC_TRUE((requires(Slice<int> s1, Slice<const int, 42, 3> s2, Slice<int, std::dynamic_extent, dynamic_stride> s3) {
+    { s1.UncheckedAt(0) } -> std::same_as<int&>;
+    { s2.UncheckedAt(0) } -> std::same_as<const int&>;
+    { s3.UncheckedAt(0) } -> std::same_as<int&>;
+    requires noexcept(s1.UncheckedAt(0));
+    requires noexcept(s2.UncheckedAt(0));
+    requires noexcept(s3.UncheckedAt(0));
+  }));
+
+TEST(SliceCheckTests, UncheckedAt) {
+  std::vector<int> vec(30);
+  std::iota(vec.begin(), vec.end(), 0);
+
+  Slice<int, std::dynamic_extent, 3> every3rd(vec.data(), vec.size(), 3);
+  Slice<int, std::dynamic_extent, dynamic_stride> every5th(vec.data(), vec.size(), 5);
+  for (std::size_t i = 0; i < every3rd.Size(); ++i)
+    EXPECT_EQ(&every3rd.UncheckedAt(i), &vec[3 * i]);
+  for (std::size_t i = 0; i < every5th.Size(); ++i)
+    EXPECT_EQ(&every5th.UncheckedAt(i), &vec[5 * i]);
+
+  every3rd.UncheckedAt(2) = 42;
+  EXPECT_EQ(vec[6], 42);
+}
+
+// Operations on ranges are validated at any level but 0
+TEST(SliceCheckTests, RangeChecks) {
+  std::vector<int> vec(10);
+  Slice<int> slice{vec};
+  Slice<int> empty{vec.data(), 0u};
+
+  EXPECT_RUNTIME_FAIL(({
+    Slice<int, 100u> big{vec};
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.First(11u);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.Last<11u>();
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.DropFirst(11u);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.DropLast<11u>();
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    empty.Front();
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    empty.Back();
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    slice.Skip<2>().DropFirst(1u).Last(4u);
+  }));
+}
+
+TEST(SliceCheckTests, ElementChecks) {
+  std::vector<int> vec(20);
+  std::iota(vec.begin(), vec.end(), 0);
+  // The memory past the end of the slice is still owned by vec, so reading it is harmless
+  auto slice = Slice<int>{vec}.Skip<2>().First(5u);
+
+#if MPC_CHECK_LEVEL >= 2
+  EXPECT_RUNTIME_FAIL(({
+    slice[5];
+  }));
+#else
+  EXPECT_RUNTIME_OK(({
+    EXPECT_EQ(slice[7], 14);
+  }));
+#endif
+
+  EXPECT_RUNTIME_OK(({
+    EXPECT_EQ(slice.UncheckedAt(7), 14);
+  }));
+}
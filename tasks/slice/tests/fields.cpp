@@ -0,0 +1,124 @@
+#include <Slice.hpp>
+#include <FieldSlice.hpp>
+#include <reflect.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+namespace {
+
+struct Hot;
+
+struct Record {
+  std::uint32_t id;
+  float value;
+
+  Annotate<Hot> _hot;
+  double weight;
+};
+
+struct Odd {
+  std::uint32_t id;
+  std::uint8_t flag;
+  std::uint8_t more;
+  std::uint16_t small;
+};
+
+struct Triple {
+  std::uint8_t r;
+  std::uint8_t g;
+  std::uint8_t b;
+};
+
+struct Texel {
+  Triple color;
+  std::uint8_t alpha;
+};
+
+static_assert(sizeof(Record) == 24);
+static_assert(sizeof(Odd) == 8);
+static_assert(sizeof(Texel) == 4);
+
+}  // namespace
+
+EXPECT_STATIC_TRUE((requires(std::span<Record> records, std::span<const Record, 4> fixed) {
+    { FieldSlice<0>(records) } -> std::same_as<Slice<std::uint32_t, std::dynamic_extent, 6>>;
+    { FieldSlice<1>(records) } -> std::same_as<Slice<float, std::dynamic_extent, 6>>;
+    // Annotations are not fields
+    { FieldSlice<2>(records) } -> std::same_as<Slice<double, std::dynamic_extent, 3>>;
+    { FieldSlice<2>(fixed) } -> std::same_as<Slice<const double, 4, 3>>;
+  }));
+
+template <std::size_t I, class T>
+concept CanFieldSlice = requires(std::span<T> records) { FieldSlice<I>(records); };
+
+EXPECT_STATIC_TRUE((requires() {
+    requires CanFieldSlice<3, Odd>;
+    requires CanFieldSlice<1, Texel>;
+    // sizeof(Texel) is not a multiple of sizeof(Triple)
+    requires !CanFieldSlice<0, Texel>;
+  }));
+
+TEST(SliceFieldsTests, Points) {
+  std::vector<Record> records(10);
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    records[i].id = static_cast<std::uint32_t>(i);
+    records[i].value = 0.5f * i;
+    records[i].weight = 2.0 * i;
+  }
+
+  auto ids = FieldSlice<0>(std::span(records));
+  auto weights = FieldSlice<2>(std::span(records));
+  ASSERT_EQ(records.size(), ids.Size());
+  ASSERT_EQ(records.size(), weights.Size());
+  EXPECT_EQ(static_cast<void*>(&records[0].id), static_cast<void*>(ids.Data()));
+  EXPECT_EQ(static_cast<void*>(&records[0].weight), static_cast<void*>(weights.Data()));
+
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    EXPECT_EQ(&records[i].id, &ids[i]);
+    EXPECT_EQ(&records[i].weight, &weights[i]);
+  }
+
+  // No copy: writes go to the records
+  for (auto& w : weights) {
+    w = -w;
+  }
+  EXPECT_EQ(-18.0, records[9].weight);
+  EXPECT_EQ(4.5f, records[9].value);
+}
+
+TEST(SliceFieldsTests, Fixed) {
+  std::array<Odd, 3> odds{};
+  odds[2].small = 7;
+
+  const std::span<const Odd, 3> view(odds);
+  auto smalls = FieldSlice<3>(view);
+  static_assert(std::is_same_v<decltype(smalls), Slice<const std::uint16_t, 3, 4>>);
+  EXPECT_EQ(7, smalls[2]);
+  EXPECT_EQ(&odds[1].small, &smalls[1]);
+}
+
+TEST(SliceFieldsTests, Empty) {
+  std::vector<Record> records;
+  EXPECT_EQ(0u, FieldSlice<1>(std::span(records)).Size());
+}
+
+TEST(SliceFieldsTests, Column) {
+  std::vector<Record> records(1'000'000);
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    records[i].value = static_cast<float>(i % 8);
+  }
+
+  auto values = FieldSlice<1>(std::span<const Record>(records));
+  double sum = std::accumulate(values.begin(), values.end(), 0.0);
+  EXPECT_EQ(3.5 * records.size(), sum);
+}
@@ -0,0 +1,190 @@
+#include <Slice.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+
+template <class T, std::ptrdiff_t stride>
+using SliceIterator = typename Slice<T, std::dynamic_extent, stride>::iterator;
+
+EXPECT_STATIC_TRUE((requires() {
+    requires std::random_access_iterator<Slice<int, 42, 42>::iterator>;
+    requires std::random_access_iterator<Slice<int, 42, dynamic_stride>::iterator>;
+    requires std::random_access_iterator<Slice<int, std::dynamic_extent, 42>::iterator>;
+    requires std::random_access_iterator<Slice<int, std::dynamic_extent, dynamic_stride>::iterator>;
+    requires std::random_access_iterator<Slice<const int, std::dynamic_extent, dynamic_stride>::iterator>;
+
+    requires std::sized_sentinel_for<SliceIterator<int, 3>, SliceIterator<int, 3>>;
+    requires std::sized_sentinel_for<SliceIterator<int, dynamic_stride>, SliceIterator<int, dynamic_stride>>;
+
+    requires std::contiguous_iterator<Slice<int>::iterator>;
+    requires std::contiguous_iterator<Slice<const int, 42>::iterator>;
+    requires !std::contiguous_iterator<SliceIterator<int, 2>>;
+    requires !std::contiguous_iterator<SliceIterator<int, dynamic_stride>>;
+  }));
+
+EXPECT_STATIC_TRUE((requires() {
+    requires std::same_as<Slice<int, 42, 3>::iterator, Slice<int, std::dynamic_extent, 3>::iterator>;
+    requires std::same_as<Slice<int, 42, dynamic_stride>::iterator, Slice<int, std::dynamic_extent, dynamic_stride>::iterator>;
+    requires std::same_as<std::iter_reference_t<SliceIterator<const int, 3>>, const int&>;
+    requires std::same_as<std::iter_value_t<SliceIterator<const int, 3>>, int>;
+    requires std::same_as<std::iter_difference_t<SliceIterator<int, 3>>, std::ptrdiff_t>;
+  }));
+
+static_assert(sizeof(SliceIterator<int, 42>) + sizeof(std::ptrdiff_t) == sizeof(SliceIterator<int, dynamic_stride>));
+static_assert(sizeof(SliceIterator<int, 1>) + sizeof(std::ptrdiff_t) == sizeof(SliceIterator<int, dynamic_stride>));
+
+EXPECT_STATIC_TRUE((requires() {
+    requires std::ranges::view<Slice<int, 42, 42>>;
+    requires std::ranges::view<Slice<int, std::dynamic_extent, dynamic_stride>>;
+    requires std::ranges::borrowed_range<Slice<int, 42, 42>>;
+    requires std::ranges::borrowed_range<Slice<const int, std::dynamic_extent, dynamic_stride>>;
+    requires std::ranges::random_access_range<Slice<int, std::dynamic_extent, 3>>;
+    requires std::ranges::sized_range<Slice<int, std::dynamic_extent, dynamic_stride>>;
+    requires std::ranges::contiguous_range<Slice<int>>;
+  }));
+
+TEST(SliceIteratorTests, Arithmetic) {
+  std::vector<int> vec(100);
+  std::iota(vec.begin(), vec.end(), 0);
+
+  auto check = [](auto slice) {
+    auto first = slice.begin();
+    auto last = slice.end();
+    const auto size = static_cast<std::ptrdiff_t>(slice.Size());
+
+    EXPECT_EQ(last - first, size);
+    EXPECT_EQ(first - last, -size);
+    EXPECT_EQ(std::ranges::distance(slice), size);
+    EXPECT_EQ(first + size, last);
+    EXPECT_EQ(size + first, last);
+    EXPECT_EQ(last - size, first);
+    EXPECT_LT(first, last);
+    EXPECT_GE(last, first);
+    EXPECT_EQ(first <=> first, std::strong_ordering::equal);
+
+    for (std::ptrdiff_t i = 0; i < size; ++i) {
+      EXPECT_EQ(first[i], slice[i]);
+      EXPECT_EQ(*(first + i), slice[i]);
+      EXPECT_EQ(*(last - (size - i)), slice[i]);
+      EXPECT_EQ((first + i) - first, i);
+    }
+
+    auto it = first;
+    it += size / 2;
+    EXPECT_EQ(*it, slice[size / 2]);
+    it -= size / 2;
+    EXPECT_EQ(it, first);
+    EXPECT_EQ(&*slice.rbegin(), &slice[size - 1]);
+  };
+
+  check(Slice(vec));
+  check(Slice(vec).Skip<3>());
+  check(Slice(vec).Skip(3));
+  check(Slice(vec).DropFirst(1).Skip<7>());
+  check(Slice(vec).Skip<2>().Skip(5).DropLast<2>());
+}
+
+TEST(SliceIteratorTests, Sort) {
+  std::vector<int> vec(99);
+  for (std::size_t i = 0; i < vec.size(); ++i)
+    vec[i] = static_cast<int>((i * 37) % 101);
+  const auto original = vec;
+
+  Slice<int, std::dynamic_extent, 3> every3rd(vec.data(), vec.size(), 3);
+  std::ranges::sort(every3rd);
+  EXPECT_TRUE(std::ranges::is_sorted(every3rd));
+
+  Slice<int, std::dynamic_extent, dynamic_stride> fromSecond(vec.data() + 1, vec.size() - 1, 3);
+  std::ranges::sort(fromSecond, std::greater<>{});
+  EXPECT_TRUE(std::ranges::is_sorted(fromSecond, std::greater<>{}));
+
+  // Elements in between must stay where they were
+  for (std::size_t i = 2; i < vec.size(); i += 3)
+    EXPECT_EQ(vec[i], original[i]);
+
+  std::vector<int> expected;
+  for (std::size_t i = 0; i < vec.size(); i += 3)
+    expected.push_back(original[i]);
+  std::ranges::sort(expected);
+  EXPECT_TRUE(std::ranges::equal(every3rd, expected));
+
+  std::ranges::reverse(every3rd);
+  EXPECT_TRUE(std::ranges::is_sorted(every3rd, std::greater<>{}));
+
+  std::nth_element(every3rd.begin(), every3rd.begin() + 5, every3rd.end());
+  EXPECT_EQ(every3rd[5], expected[5]);
+}
+
+TEST(SliceIteratorTests, BinarySearch) {
+  std::vector<int> vec(1000);
+  std::iota(vec.begin(), vec.end(), 0);
+
+  Slice<const int, std::dynamic_extent, 10> tens(vec.data(), vec.size(), 10);
+  ASSERT_EQ(tens.Size(), 100u);
+
+  std::size_t comparisons = 0;
+  auto counting = [&comparisons](int lhs, int rhs) {
+    ++comparisons;
+    return lhs < rhs;
+  };
+
+  for (int value = -5; value < 1005; ++value) {
+    comparisons = 0;
+    auto it = std::ranges::lower_bound(tens, value, counting);
+    EXPECT_LE(comparisons, 8u);   // ceil(log2(100)) + 1
+
+    auto expected = std::ranges::find_if(tens, [value](int x) { return x >= value; });
+    EXPECT_EQ(it, expected);
+    EXPECT_EQ(std::ranges::binary_search(tens, value), value >= 0 && value < 1000 && value % 10 == 0);
+  }
+
+  auto [first, last] = std::ranges::equal_range(Slice(vec).Skip(5), 500);
+  EXPECT_EQ(last - first, 1);
+  EXPECT_EQ(*first, 500);
+}
+
+TEST(SliceIteratorTests, Views) {
+  std::vector<int> vec(42);
+  std::iota(vec.begin(), vec.end(), 0);
+
+  auto lastEvens = Slice(vec).Skip<2>() | std::views::reverse | std::views::take(3);
+  EXPECT_TRUE(std::ranges::equal(lastEvens, std::vector{40, 38, 36}));
+
+  auto squares = Slice(vec).Skip(10) | std::views::drop(1)
+    | std::views::transform([](int x) { return x * x; });
+  EXPECT_TRUE(std::ranges::equal(squares, std::vector{100, 400, 900, 1600}));
+
+  // Borrowed range: iterators outlive the temporary slice
+  auto it = std::ranges::find(Slice(vec).Skip<5>(), 25);
+  static_assert(!std::same_as<decltype(it), std::ranges::dangling>);
+  EXPECT_EQ(*it, 25);
+}
+
+TEST(SliceIteratorTests, RuntimeChecks) {
+  std::vector<int> vec(10);
+  Slice<int, std::dynamic_extent, 3> slice(vec.data(), vec.size(), 3);
+
+  EXPECT_RUNTIME_OK(({
+    slice.begin() + 4;
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.begin() + 5;
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    slice.end() - 5;
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    *slice.end();
+  }));
+}
@@ -0,0 +1,286 @@
+#include <Slice.hpp>
+#include <MappedFile.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+
+namespace {
+
+struct Record {
+  std::uint32_t id;
+  float value;
+  double weight;
+};
+
+struct WithString {
+  std::string name;
+};
+
+struct Pixel {
+  std::uint8_t tag;
+  std::uint8_t rgb[3];
+  std::uint8_t alpha;
+};
+
+static_assert(sizeof(Record) == 16);
+static_assert(sizeof(Pixel) == 5);
+
+// Removes the file on scope exit. The name is unique to the process and
+// the object, so tests running in parallel do not share files
+class TempFile {
+ public:
+  explicit TempFile(const std::string& name)
+    : path_(std::filesystem::temp_directory_path() / ("mpc-mapped-" + name + "-" + UniqueSuffix())) {
+  }
+
+  ~TempFile() {
+    std::error_code ignored;
+    std::filesystem::remove(path_, ignored);
+  }
+
+  template <class T>
+  void Write(const std::vector<T>& data, std::size_t padding = 0) const {
+    std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+    const std::vector<char> zeros(padding);
+    out.write(zeros.data(), zeros.size());
+    out.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+  }
+
+  const std::filesystem::path& Path() const {
+    return path_;
+  }
+
+ private:
+  static std::string UniqueSuffix() {
+    static const std::string process = std::to_string(std::random_device{}());
+    static std::atomic<unsigned> counter{0};
+    return process + "-" + std::to_string(counter.fetch_add(1));
+  }
+
+  std::filesystem::path path_;
+};
+
+std::vector<Record> makeRecords(std::size_t count) {
+  std::vector<Record> records(count);
+  for (std::size_t i = 0; i < count; ++i)
+    records[i] = Record{static_cast<std::uint32_t>(i), 0.5f * i, 2.0 * i};
+  return records;
+}
+
+}  // namespace
+
+EXPECT_STATIC_TRUE((requires(Slice<int, 4> s1, Slice<int> s2, Slice<const Record, 3> s3) {
+    { AsBytes(s1) } -> std::same_as<Slice<const std::byte, 4 * sizeof(int)>>;
+    { AsBytes(s2) } -> std::same_as<Slice<const std::byte>>;
+    { AsBytes(s3) } -> std::same_as<Slice<const std::byte, 3 * sizeof(Record)>>;
+    { AsWritableBytes(s1) } -> std::same_as<Slice<std::byte, 4 * sizeof(int)>>;
+    { AsWritableBytes(s2) } -> std::same_as<Slice<std::byte>>;
+  }));
+
+template <class S>
+concept HasAsBytes = requires(S s) { AsBytes(s); };
+
+template <class S>
+concept HasAsWritableBytes = requires(S s) { AsWritableBytes(s); };
+
+EXPECT_STATIC_TRUE((requires() {
+    requires !HasAsWritableBytes<Slice<const int>>;
+    requires !HasAsBytes<Slice<int, 4, 2>>;
+    requires !HasAsBytes<Slice<int, std::dynamic_extent, dynamic_stride>>;
+    requires !HasAsWritableBytes<Slice<int, std::dynamic_extent, 3>>;
+  }));
+
+EXPECT_STATIC_TRUE((requires(const MappedFile file) {
+    requires !std::is_copy_constructible_v<MappedFile>;
+    requires !std::is_copy_assignable_v<MappedFile>;
+    requires std::is_nothrow_move_constructible_v<MappedFile>;
+    requires std::is_nothrow_move_assignable_v<MappedFile>;
+
+    { file.Size() } -> std::same_as<std::size_t>;
+    { file.Bytes() } -> std::same_as<Slice<const std::byte>>;
+    { file.View<Record>() } -> std::same_as<Slice<const Record>>;
+    { file.View<int>(4, 2) } -> std::same_as<Slice<const int>>;
+    { file.FieldView<&Record::value>() } -> std::same_as<Slice<const float, std::dynamic_extent, 4>>;
+    { file.FieldView<&Record::weight>(8, 1) } -> std::same_as<Slice<const double, std::dynamic_extent, 2>>;
+    { file.FieldView<&Pixel::alpha>() } -> std::same_as<Slice<const std::uint8_t, std::dynamic_extent, 5>>;
+  }));
+
+template <class T>
+concept CanView = requires(const MappedFile file) { file.View<T>(); };
+
+template <auto member>
+concept CanFieldView = requires(const MappedFile file) { file.FieldView<member>(); };
+
+EXPECT_STATIC_TRUE((requires() {
+    requires !CanView<WithString>;
+    requires !CanFieldView<&WithString::name>;
+    requires !CanFieldView<&Pixel::rgb>;
+  }));
+
+TEST(SliceMappedTests, AsBytes) {
+  std::vector<std::uint32_t> vec{0x01020304u, 0x05060708u};
+  Slice<std::uint32_t, 2> slice{vec};
+
+  auto bytes = AsBytes(slice);
+  ASSERT_EQ(bytes.Size(), 8u);
+  EXPECT_EQ(static_cast<const void*>(bytes.Data()), static_cast<const void*>(vec.data()));
+
+  auto writable = AsWritableBytes(Slice<std::uint32_t>{vec}.DropFirst(1));
+  ASSERT_EQ(writable.Size(), 4u);
+  for (auto& b : writable)
+    b = std::byte{0};
+  EXPECT_EQ(vec[0], 0x01020304u);
+  EXPECT_EQ(vec[1], 0u);
+}
+
+TEST(SliceMappedTests, Records) {
+  TempFile tmp("records");
+  const auto records = makeRecords(1000);
+  tmp.Write(records);
+
+  auto file = MappedFile::Open(tmp.Path());
+  ASSERT_EQ(file.Size(), records.size() * sizeof(Record));
+  ASSERT_EQ(file.Bytes().Size(), file.Size());
+
+  auto all = file.View<Record>();
+  ASSERT_EQ(all.Size(), records.size());
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    EXPECT_EQ(all[i].id, records[i].id);
+    EXPECT_EQ(all[i].value, records[i].value);
+    EXPECT_EQ(all[i].weight, records[i].weight);
+  }
+
+  auto some = file.View<Record>(10 * sizeof(Record), 5);
+  ASSERT_EQ(some.Size(), 5u);
+  EXPECT_EQ(some.Front().id, 10u);
+  EXPECT_EQ(some.Back().id, 14u);
+
+  auto ids = file.View<std::uint32_t>();
+  EXPECT_EQ(ids.Size(), records.size() * 4);
+  EXPECT_EQ(ids.Skip<4>()[7], 7u);
+}
+
+TEST(SliceMappedTests, Fields) {
+  TempFile tmp("fields");
+  const auto records = makeRecords(333);
+  // A small header in front of the records
+  tmp.Write(records, 16);
+
+  auto file = MappedFile::Open(tmp.Path());
+
+  auto values = file.FieldView<&Record::value>(16);
+  ASSERT_EQ(values.Size(), records.size());
+  for (std::size_t i = 0; i < records.size(); ++i)
+    EXPECT_EQ(values[i], records[i].value);
+  EXPECT_EQ(static_cast<const void*>(&values[0]), static_cast<const void*>(file.Bytes().Data() + 16 + offsetof(Record, value)));
+
+  auto weights = file.FieldView<&Record::weight>(16 + 100 * sizeof(Record), 10);
+  ASSERT_EQ(weights.Size(), 10u);
+  for (std::size_t i = 0; i < weights.Size(); ++i)
+    EXPECT_EQ(weights[i], records[100 + i].weight);
+
+  auto ids = file.FieldView<&Record::id>(16);
+  std::uint64_t sum = 0;
+  for (auto id : ids)
+    sum += id;
+  EXPECT_EQ(sum, 333u * 332u / 2);
+}
+
+TEST(SliceMappedTests, ZeroCopy) {
+  TempFile tmp("zero-copy");
+  std::vector<std::uint32_t> data(4096, 7);
+  tmp.Write(data);
+
+  auto file = MappedFile::Open(tmp.Path());
+  auto view = file.View<std::uint32_t>();
+  EXPECT_EQ(static_cast<const void*>(view.Data()), static_cast<const void*>(file.Bytes().Data()));
+  EXPECT_EQ(static_cast<const void*>(view.Data()), static_cast<const void*>(file.View<std::uint32_t>().Data()));
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.Data()) % 4096, 0u) << "mmap returns page-aligned memory";
+
+  // A shared mapping sees writes made through the file after it was mapped
+  {
+    std::fstream out(tmp.Path(), std::ios::binary | std::ios::in | std::ios::out);
+    out.seekp(100 * sizeof(std::uint32_t));
+    const std::uint32_t value = 42;
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  EXPECT_EQ(view[100], 42u);
+
+  // Moving the owner keeps the mapping alive
+  MappedFile other = std::move(file);
+  EXPECT_EQ(other.View<std::uint32_t>().Data(), view.Data());
+  EXPECT_EQ(view[100], 42u);
+  EXPECT_EQ(view[101], 7u);
+
+  file = std::move(other);
+  EXPECT_EQ(file.Size(), data.size() * sizeof(std::uint32_t));
+}
+
+TEST(SliceMappedTests, EmptyFile) {
+  TempFile tmp("empty");
+  tmp.Write(std::vector<char>{});
+
+  auto file = MappedFile::Open(tmp.Path());
+  EXPECT_EQ(file.Size(), 0u);
+  EXPECT_EQ(file.Bytes().Size(), 0u);
+  EXPECT_EQ(file.View<Record>().Size(), 0u);
+  EXPECT_EQ(file.FieldView<&Record::value>().Size(), 0u);
+}
+
+TEST(SliceMappedTests, RuntimeChecks) {
+  TempFile tmp("checks");
+  tmp.Write(makeRecords(10));
+  auto file = MappedFile::Open(tmp.Path());
+
+  EXPECT_THROW(MappedFile::Open(tmp.Path().string() + "-does-not-exist"), std::system_error);
+
+  EXPECT_RUNTIME_OK(({
+    file.View<Record>(0, 10);
+    file.View<Record>(160);
+    file.View<std::uint32_t>(4, 3);
+    file.FieldView<&Record::weight>(9 * sizeof(Record));
+  }));
+
+  // Out of range
+  EXPECT_RUNTIME_FAIL(({
+    file.View<Record>(0, 11);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    file.View<Record>(161);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    file.FieldView<&Record::value>(0, 11);
+  }));
+
+  // Misaligned
+  EXPECT_RUNTIME_FAIL(({
+    file.View<std::uint32_t>(2, 1);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    file.FieldView<&Record::weight>(4, 1);
+  }));
+
+  // The rest of the file is not a whole number of objects
+  EXPECT_RUNTIME_FAIL(({
+    file.View<Record>(8);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    file.FieldView<&Record::id>(sizeof(Record) * 5 + 4);
+  }));
+}
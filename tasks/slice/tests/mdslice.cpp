@@ -0,0 +1,300 @@
+#include <MdSlice.hpp>
+#include <Slice.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+static_assert(std::same_as<RowMajorStrides<Extents<4, 5, 6>>, Strides<30, 6, 1>>);
+static_assert(std::same_as<RowMajorStrides<Extents<std::dynamic_extent, 5, 6>>, Strides<30, 6, 1>>);
+static_assert(std::same_as<RowMajorStrides<Extents<4, std::dynamic_extent, 6>>, Strides<dynamic_stride, 6, 1>>);
+static_assert(std::same_as<RowMajorStrides<Extents<4, 5, std::dynamic_extent>>, Strides<dynamic_stride, dynamic_stride, 1>>);
+
+static_assert(sizeof(MdSlice<float, 16, 16>) == sizeof(void*));
+static_assert(sizeof(MdSlice<float, 2, 3, 4>) == sizeof(void*));
+static_assert(sizeof(MdSlice<float, std::dynamic_extent, 16>) == sizeof(void*) + sizeof(std::size_t));
+static_assert(sizeof(MdSlice<float, 16, std::dynamic_extent>)
+  == sizeof(void*) + sizeof(std::size_t) + sizeof(std::ptrdiff_t));
+static_assert(sizeof(BasicMdSlice<float, Extents<8, 8>, Strides<dynamic_stride, dynamic_stride>>)
+  == sizeof(void*) + 2 * sizeof(std::ptrdiff_t));
+
+EXPECT_STATIC_TRUE((requires(MdSlice<int, 4, 6> m, MdSlice<int, std::dynamic_extent, std::dynamic_extent> d) {
+    requires decltype(m)::Rank() == 2;
+    requires MdSlice<int, 1, 2, 3, 4>::Rank() == 4;
+
+    { m.Row(0) } -> std::same_as<Slice<int, 6, 1>>;
+    { m.Column(0) } -> std::same_as<Slice<int, 4, 6>>;
+    { d.Row(0) } -> std::same_as<Slice<int, std::dynamic_extent, 1>>;
+    { d.Column(0) } -> std::same_as<Slice<int, std::dynamic_extent, dynamic_stride>>;
+
+    { m.Transpose() } -> std::same_as<BasicMdSlice<int, Extents<6, 4>, Strides<1, 6>>>;
+    { m.Tile<2, 3>(0, 0) } -> std::same_as<BasicMdSlice<int, Extents<2, 3>, Strides<6, 1>>>;
+    { m.Tile({0, 0}, {2, 3}) }
+      -> std::same_as<BasicMdSlice<int, Extents<std::dynamic_extent, std::dynamic_extent>, Strides<6, 1>>>;
+    { m.Fix<0>(1) } -> std::same_as<BasicMdSlice<int, Extents<6>, Strides<1>>>;
+    { m.Fix<1>(1) } -> std::same_as<BasicMdSlice<int, Extents<4>, Strides<6>>>;
+
+    { m(1, 2) } -> std::same_as<int&>;
+  }));
+
+EXPECT_STATIC_TRUE((requires() {
+    requires std::is_trivially_copyable_v<MdSlice<int, 4, 6>>;
+    requires std::is_trivially_copyable_v<MdSlice<int, std::dynamic_extent, 6>>;
+    requires std::copyable<MdSlice<int, 4, 6>>;
+    requires std::equality_comparable<MdSlice<int, 4, 6>>;
+
+    requires std::convertible_to<MdSlice<int, 4, 6>, MdSlice<const int, 4, 6>>;
+    requires std::convertible_to<MdSlice<int, 4, 6>, MdSlice<int, std::dynamic_extent, 6>>;
+    requires std::convertible_to<MdSlice<int, 4, 6>, MdSlice<int, std::dynamic_extent, std::dynamic_extent>>;
+    requires std::convertible_to<MdSlice<int, 4, 6>,
+      BasicMdSlice<const int, Extents<4, 6>, Strides<dynamic_stride, dynamic_stride>>>;
+    requires !std::convertible_to<MdSlice<const int, 4, 6>, MdSlice<int, 4, 6>>;
+    requires !std::convertible_to<MdSlice<int, 4, 6>, MdSlice<int, 6, 4>>;
+  }));
+
+TEST(MdSliceTests, Basics) {
+  std::array<int, 24> data;
+  std::iota(data.begin(), data.end(), 0);
+
+  MdSlice<int, 4, 6> m(data.data());
+  static_assert(m.Extent<0>() == 4);
+  static_assert(m.Extent<1>() == 6);
+  static_assert(m.Stride<0>() == 6);
+  static_assert(m.Stride<1>() == 1);
+  static_assert(m.Size() == 24);
+  EXPECT_EQ(m.Data(), data.data());
+
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 6; ++j)
+      EXPECT_EQ(m(i, j), static_cast<int>(i * 6 + j));
+
+  MdSlice<int, std::dynamic_extent, std::dynamic_extent> d(data.data(), {4, 6});
+  EXPECT_EQ(d.Extent<0>(), 4u);
+  EXPECT_EQ(d.Extent<1>(), 6u);
+  EXPECT_EQ(d.Stride<0>(), 6);
+  EXPECT_EQ(d.Size(), 24u);
+  EXPECT_EQ(d, m);
+
+  MdSlice<const int, std::dynamic_extent, 6> c = m;
+  EXPECT_EQ(c, m);
+  EXPECT_EQ(c(3, 5), 23);
+
+  m(1, 1) = 100;
+  EXPECT_EQ(data[7], 100);
+
+  MdSlice<int, 2, 3, 4> cube(data.data());
+  EXPECT_EQ(cube(1, 2, 3), data[23]);
+  EXPECT_EQ(&cube(1, 0, 2), &data[14]);
+}
+
+TEST(MdSliceTests, RowsAndColumns) {
+  std::vector<int> data(4 * 6);
+  std::iota(data.begin(), data.end(), 0);
+  MdSlice<int, 4, 6> m(data.data());
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    auto row = m.Row(i);
+    static_assert(row.Size() == 6);
+    EXPECT_TRUE(std::ranges::equal(row, std::vector<int>(data.begin() + i * 6, data.begin() + i * 6 + 6)));
+  }
+
+  for (std::size_t j = 0; j < 6; ++j) {
+    auto column = m.Column(j);
+    static_assert(column.Size() == 4);
+    static_assert(column.Stride() == 6);
+    for (std::size_t i = 0; i < 4; ++i)
+      EXPECT_EQ(&column[i], &m(i, j));
+  }
+
+  MdSlice<int, std::dynamic_extent, std::dynamic_extent> d = m;
+  EXPECT_EQ(d.Column(2), m.Column(2));
+  EXPECT_EQ(d.Row(3), m.Row(3));
+
+  auto fixedRow = m.Fix<0>(2);
+  auto fixedColumn = m.Fix<1>(2);
+  for (std::size_t k = 0; k < 6; ++k)
+    EXPECT_EQ(&fixedRow(k), &m(2, k));
+  for (std::size_t k = 0; k < 4; ++k)
+    EXPECT_EQ(&fixedColumn(k), &m(k, 2));
+
+  MdSlice<int, 2, 3, 4> cube(data.data());
+  auto plane = cube.Fix<1>(2);
+  static_assert(decltype(plane)::Rank() == 2);
+  static_assert(plane.Extent<0>() == 2 && plane.Extent<1>() == 4);
+  static_assert(plane.Stride<0>() == 12 && plane.Stride<1>() == 1);
+  for (std::size_t i = 0; i < 2; ++i)
+    for (std::size_t k = 0; k < 4; ++k)
+      EXPECT_EQ(&plane(i, k), &cube(i, 2, k));
+}
+
+TEST(MdSliceTests, Tiles) {
+  std::vector<int> data(8 * 10);
+  std::iota(data.begin(), data.end(), 0);
+  MdSlice<int, 8, 10> m(data.data());
+
+  auto tile = m.Tile<3, 4>(2, 5);
+  static_assert(sizeof(tile) == sizeof(void*));
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      EXPECT_EQ(&tile(i, j), &m(2 + i, 5 + j));
+
+  auto dynTile = m.Tile({2, 5}, {3, 4});
+  EXPECT_EQ(dynTile, tile);
+
+  auto tileOfTile = tile.Tile<2, 2>(1, 2);
+  EXPECT_EQ(&tileOfTile(1, 1), &m(4, 8));
+  EXPECT_EQ(tile.Column(3), m.Column(8).DropFirst<2>().First<3>());
+
+  auto t = m.Transpose();
+  static_assert(t.Extent<0>() == 10 && t.Extent<1>() == 8);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 10; ++j)
+      EXPECT_EQ(&t(j, i), &m(i, j));
+  EXPECT_EQ(t.Transpose(), m);
+  EXPECT_EQ(t.Row(3), m.Column(3));
+}
+
+TEST(MdSliceTests, ForEachTile) {
+  constexpr std::size_t rows = 10;
+  constexpr std::size_t columns = 7;
+  std::vector<int> data(rows * columns, 0);
+  MdSlice<int, rows, columns> m(data.data());
+
+  std::vector<const int*> origins;
+  std::size_t fullTiles = 0;
+  m.ForEachTile<4, 3>([&](auto tile) {
+    if constexpr (std::same_as<decltype(tile), decltype(m.Tile<4, 3>(0, 0))>)
+      ++fullTiles;
+    origins.push_back(tile.Data());
+    for (std::size_t i = 0; i < tile.template Extent<0>(); ++i)
+      for (std::size_t j = 0; j < tile.template Extent<1>(); ++j)
+        ++tile(i, j);
+  });
+
+  // Every element is visited exactly once
+  EXPECT_TRUE(std::ranges::all_of(data, [](int x) { return x == 1; }));
+  EXPECT_EQ(fullTiles, 2u * 2u);
+
+  std::vector<const int*> expected;
+  for (std::size_t i = 0; i < rows; i += 4)
+    for (std::size_t j = 0; j < columns; j += 3)
+      expected.push_back(&m(i, j));
+  EXPECT_EQ(origins, expected);
+
+  std::vector<std::pair<std::size_t, std::size_t>> shapes;
+  MdSlice<int, std::dynamic_extent, std::dynamic_extent>(data.data(), {rows, columns})
+    .ForEachTile<8, 8>([&](auto tile) {
+      shapes.emplace_back(tile.template Extent<0>(), tile.template Extent<1>());
+    });
+  EXPECT_EQ(shapes, (std::vector<std::pair<std::size_t, std::size_t>>{{8, 7}, {2, 7}}));
+}
+
+TEST(MdSliceTests, BlockedKernels) {
+  constexpr std::size_t n = 37;
+  std::vector<int> a(n * n);
+  std::vector<int> b(n * n);
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    a[i] = static_cast<int>(i % 13);
+    b[i] = static_cast<int>(i % 7) - 3;
+  }
+  MdSlice<const int, n, n> ma(a.data());
+  MdSlice<const int, n, n> mb(b.data());
+
+  // Transpose
+  std::vector<int> t(n * n);
+  MdSlice<int, n, n> mt(t.data());
+  ma.ForEachTile<8, 8>([&](auto tile) {
+    const std::size_t i0 = static_cast<std::size_t>(tile.Data() - ma.Data()) / n;
+    const std::size_t j0 = static_cast<std::size_t>(tile.Data() - ma.Data()) % n;
+    for (std::size_t i = 0; i < tile.template Extent<0>(); ++i)
+      for (std::size_t j = 0; j < tile.template Extent<1>(); ++j)
+        mt(j0 + j, i0 + i) = tile(i, j);
+  });
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      EXPECT_EQ(mt(j, i), ma(i, j));
+
+  // Multiply
+  std::vector<int> c(n * n, 0);
+  MdSlice<int, n, n> mc(c.data());
+  constexpr std::size_t block = 8;
+  for (std::size_t i0 = 0; i0 < n; i0 += block)
+    for (std::size_t k0 = 0; k0 < n; k0 += block)
+      for (std::size_t j0 = 0; j0 < n; j0 += block) {
+        const std::size_t ib = std::min(block, n - i0);
+        const std::size_t kb = std::min(block, n - k0);
+        const std::size_t jb = std::min(block, n - j0);
+        auto ta = ma.Tile({i0, k0}, {ib, kb});
+        auto tb = mb.Tile({k0, j0}, {kb, jb});
+        auto tc = mc.Tile({i0, j0}, {ib, jb});
+        for (std::size_t i = 0; i < ib; ++i)
+          for (std::size_t k = 0; k < kb; ++k)
+            for (std::size_t j = 0; j < jb; ++j)
+              tc(i, j) += ta(i, k) * tb(k, j);
+      }
+
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j) {
+      int expected = 0;
+      for (std::size_t k = 0; k < n; ++k)
+        expected += a[i * n + k] * b[k * n + j];
+      EXPECT_EQ(mc(i, j), expected);
+    }
+}
+
+TEST(MdSliceTests, RuntimeChecks) {
+  std::vector<int> data(4 * 6);
+  MdSlice<int, 4, 6> m(data.data());
+  MdSlice<int, std::dynamic_extent, std::dynamic_extent> d(data.data(), {4, 6});
+
+  EXPECT_RUNTIME_OK(({
+    m(3, 5);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    m(4, 0);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    d(0, 6);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    m.Row(4);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    d.Column(6);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    m.Fix<1>(6);
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    m.Tile<2, 2>(2, 4);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    m.Tile<2, 2>(3, 0);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    d.Tile({0, 0}, {4, 7});
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    MdSlice<int, 4, 6> wrong(data.data(), {6, 4});
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    BasicMdSlice<int, Extents<4, 6>, Strides<6, 1>> wrong(data.data(), {4, 6}, {1, 4});
+  }));
+}
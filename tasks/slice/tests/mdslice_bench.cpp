@@ -0,0 +1,124 @@
+#include <MdSlice.hpp>
+#include <Slice.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+// Blocked kernels on MdSlice tiles against the same kernels written with
+// nested Slices, one row or column at a time
+
+constexpr std::size_t kTransposeSize = 1024;
+constexpr std::size_t kMultiplySize = 256;
+constexpr std::size_t kTile = 16;
+constexpr std::size_t kBlock = 32;
+
+std::vector<float> MakeMatrix(std::size_t n) {
+  std::vector<float> data(n * n);
+  std::iota(data.begin(), data.end(), 0.f);
+  return data;
+}
+
+void BM_TransposeSlices(benchmark::State& state) {
+  constexpr std::size_t n = kTransposeSize;
+  auto a = MakeMatrix(n);
+  std::vector<float> t(n * n);
+  for (auto _ : state) {
+    Slice<const float> source(a);
+    Slice<float> target(t);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto row = source.DropFirst(i * n).First(n);
+      auto column = target.DropFirst(i).Skip(n);
+      for (std::size_t j = 0; j < n; ++j) {
+        column[j] = row[j];
+      }
+    }
+    benchmark::DoNotOptimize(t.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_TransposeSlices);
+
+void BM_TransposeTiles(benchmark::State& state) {
+  constexpr std::size_t n = kTransposeSize;
+  auto a = MakeMatrix(n);
+  std::vector<float> t(n * n);
+  for (auto _ : state) {
+    MdSlice<const float, n, n> source(a.data());
+    auto target = MdSlice<float, n, n>(t.data()).Transpose();
+    source.ForEachTile<kTile, kTile>([&](auto tile) {
+      const auto offset = static_cast<std::size_t>(tile.Data() - source.Data());
+      for (std::size_t i = 0; i < tile.template Extent<0>(); ++i) {
+        for (std::size_t j = 0; j < tile.template Extent<1>(); ++j) {
+          target(offset / n + i, offset % n + j) = tile(i, j);
+        }
+      }
+    });
+    benchmark::DoNotOptimize(t.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_TransposeTiles);
+
+void BM_MultiplySlices(benchmark::State& state) {
+  constexpr std::size_t n = kMultiplySize;
+  auto a = MakeMatrix(n);
+  auto b = MakeMatrix(n);
+  std::vector<float> c(n * n);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < n; ++i) {
+      auto row = Slice<const float>(a).DropFirst(i * n).First(n);
+      for (std::size_t j = 0; j < n; ++j) {
+        auto column = Slice<const float>(b).DropFirst(j).Skip(n);
+        float sum = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+          sum += row[k] * column[k];
+        }
+        c[i * n + j] = sum;
+      }
+    }
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(BM_MultiplySlices);
+
+void BM_MultiplyTiles(benchmark::State& state) {
+  constexpr std::size_t n = kMultiplySize;
+  static_assert(n % kBlock == 0);
+  auto a = MakeMatrix(n);
+  auto b = MakeMatrix(n);
+  std::vector<float> c(n * n);
+  MdSlice<const float, n, n> ma(a.data());
+  MdSlice<const float, n, n> mb(b.data());
+  MdSlice<float, n, n> mc(c.data());
+  for (auto _ : state) {
+    std::fill(c.begin(), c.end(), 0.f);
+    for (std::size_t i0 = 0; i0 < n; i0 += kBlock) {
+      for (std::size_t k0 = 0; k0 < n; k0 += kBlock) {
+        auto ta = ma.Tile<kBlock, kBlock>(i0, k0);
+        for (std::size_t j0 = 0; j0 < n; j0 += kBlock) {
+          auto tb = mb.Tile<kBlock, kBlock>(k0, j0);
+          auto tc = mc.Tile<kBlock, kBlock>(i0, j0);
+          for (std::size_t i = 0; i < kBlock; ++i) {
+            for (std::size_t k = 0; k < kBlock; ++k) {
+              for (std::size_t j = 0; j < kBlock; ++j) {
+                tc(i, j) += ta(i, k) * tb(k, j);
+              }
+            }
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(BM_MultiplyTiles);
@@ -0,0 +1,74 @@
+#include <Span.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+// Span has to cost nothing over a pointer and a size: all of these should
+// run at the same speed with MPC_CHECK_LEVEL=1 (see bench_runtime_hoisted)
+
+constexpr std::size_t kStaticSize = 1 << 12;
+
+std::vector<int> MakeData(std::size_t size) {
+  std::vector<int> data(size);
+  std::iota(data.begin(), data.end(), 0);
+  return data;
+}
+
+void BM_Pointer(benchmark::State& state) {
+  auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    const int* values = data.data();
+    int sum = 0;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      sum += values[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Pointer)->Range(1 << 8, 1 << 20);
+
+void BM_SpanIndex(benchmark::State& state) {
+  auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    Span<const int> span(data);
+    int sum = 0;
+    for (std::size_t i = 0; i < span.Size(); ++i) {
+      sum += span[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpanIndex)->Range(1 << 8, 1 << 20);
+
+void BM_SpanIterator(benchmark::State& state) {
+  auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    Span<const int> span(data);
+    int sum = 0;
+    for (int x : span) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpanIterator)->Range(1 << 8, 1 << 20);
+
+void BM_StaticSpanIndex(benchmark::State& state) {
+  auto data = MakeData(kStaticSize);
+  for (auto _ : state) {
+    Span<const int, kStaticSize> span(data);
+    int sum = 0;
+    for (std::size_t i = 0; i < span.Size(); ++i) {
+      sum += span[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kStaticSize);
+}
+BENCHMARK(BM_StaticSpanIndex);
@@ -0,0 +1,83 @@
+#include <testing/assert.hpp>
+#include <Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+
+EXPECT_STATIC_TRUE((requires(Span<int> s1, Span<const int, 42> s2) {
+    { s1.UncheckedAt(0) } -> std::same_as<int&>;
+    { s2.UncheckedAt(0) } -> std::same_as<const int&>;
+    requires noexcept(s1.UncheckedAt(0));
+    requires noexcept(s2.UncheckedAt(0));
+  }));
+
+TEST(SpanCheckTests, UncheckedAt) {
+  std::vector<int> vec(10);
+  std::iota(vec.begin(), vec.end(), 0);
+  Span<int> span(vec);
+
+  for (std::size_t i = 0; i < span.Size(); ++i)
+    EXPECT_EQ(&span.UncheckedAt(i), &vec[i]);
+
+  span.UncheckedAt(3) = 42;
+  EXPECT_EQ(vec[3], 42);
+
+  static constexpr std::array kArr{1, 2, 3};
+  static_assert(Span(kArr).UncheckedAt(2) == 3);
+}
+
+// Operations on ranges are validated at any level but 0
+TEST(SpanCheckTests, RangeChecks) {
+  std::vector<int> vec(10);
+  Span<int> span(vec);
+  Span<int> empty{vec.data(), 0};
+
+  EXPECT_RUNTIME_FAIL(({
+    Span<int, 100u> big{vec};
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    span.First(11u);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    span.Last<11u>();
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    empty.Front();
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    empty.Back();
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    span.First(10u).Last<3u>();
+  }));
+}
+
+TEST(SpanCheckTests, ElementChecks) {
+  std::vector<int> vec(10);
+  std::iota(vec.begin(), vec.end(), 0);
+  // The memory past the end of the span is still owned by vec, so reading it is harmless
+  Span<int> span = Span<int>(vec).First(5u);
+
+#if MPC_CHECK_LEVEL >= 2
+  EXPECT_RUNTIME_FAIL(({
+    span[5];
+  }));
+#else
+  EXPECT_RUNTIME_OK(({
+    EXPECT_EQ(span[7], 7);
+  }));
+#endif
+
+  EXPECT_RUNTIME_OK(({
+    EXPECT_EQ(span.UncheckedAt(7), 7);
+  }));
+}
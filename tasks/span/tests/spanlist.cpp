@@ -0,0 +1,244 @@
+#include <testing/assert.hpp>
+#include <Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#include <unistd.h>
+#define MPC_HAS_IOVEC 1
+#endif
+
+
+static_assert(std::forward_iterator<SpanList<int>::iterator>);
+static_assert(std::ranges::forward_range<SpanList<int>>);
+static_assert(std::ranges::forward_range<SpanList<const int>>);
+
+EXPECT_STATIC_TRUE((requires(const SpanList<int>& list, const SpanList<const int>& clist) {
+    { list[0] } -> std::same_as<int&>;
+    { clist[0] } -> std::same_as<const int&>;
+    { list.First(1) } -> std::same_as<SpanList<int>>;
+    { list.DropFirst(1) } -> std::same_as<SpanList<int>>;
+    { list.Size() } -> std::same_as<std::size_t>;
+    { list.SegmentCount() } -> std::same_as<std::size_t>;
+  }));
+
+// Inline segments are stored inside
+static_assert(sizeof(SpanList<int, 16>) > sizeof(SpanList<int, 4>));
+static_assert(sizeof(SpanList<int, 4>) >= 4 * sizeof(Span<int>));
+
+namespace {
+
+// [from, from + count) in pieces of the given sizes
+struct Pieces {
+  std::vector<std::vector<int>> storage;
+
+  Pieces(std::initializer_list<std::size_t> sizes, int from = 0) {
+    for (std::size_t size : sizes) {
+      std::vector<int>& piece = storage.emplace_back(size);
+      std::iota(piece.begin(), piece.end(), from);
+      from += static_cast<int>(size);
+    }
+  }
+
+  template <std::size_t inline_segments = 8>
+  SpanList<int, inline_segments> List() {
+    SpanList<int, inline_segments> list;
+    for (std::vector<int>& piece : storage) {
+      list.PushBack(Span<int>(piece));
+    }
+    return list;
+  }
+};
+
+template <class List>
+std::vector<int> Collect(const List& list) {
+  return std::vector<int>(list.begin(), list.end());
+}
+
+std::vector<int> Iota(int from, int count) {
+  std::vector<int> result(count);
+  std::iota(result.begin(), result.end(), from);
+  return result;
+}
+
+}  // namespace
+
+TEST(SpanListTests, Basics) {
+  SpanList<int> empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(empty.Size(), 0u);
+  EXPECT_EQ(empty.SegmentCount(), 0u);
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  Pieces pieces{3, 0, 1, 4};
+  auto list = pieces.List();
+  EXPECT_FALSE(list.Empty());
+  EXPECT_EQ(list.Size(), 8u);
+  // The empty piece is not stored
+  EXPECT_EQ(list.SegmentCount(), 3u);
+  EXPECT_EQ(list.Segments()[1].Data(), pieces.storage[2].data());
+  EXPECT_EQ(list.Segments()[2].Size(), 4u);
+
+  EXPECT_EQ(Collect(list), Iota(0, 8));
+  EXPECT_EQ(std::ranges::distance(list), 8);
+}
+
+TEST(SpanListTests, InitializerList) {
+  std::array<int, 2> a{1, 2};
+  std::vector<int> b{3, 4, 5};
+  SpanList<const int> list{Span<const int>(a), Span<const int>(), Span<const int>(b)};
+
+  EXPECT_EQ(list.SegmentCount(), 2u);
+  EXPECT_EQ(Collect(list), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(SpanListTests, Indexing) {
+  Pieces pieces{1, 5, 2, 7, 1, 1, 3};
+  auto list = pieces.List();
+
+  for (std::size_t i = 0; i < list.Size(); ++i) {
+    EXPECT_EQ(list[i], static_cast<int>(i));
+  }
+
+  // Refers to the data, does not copy it
+  list[6] = 42;
+  EXPECT_EQ(pieces.storage[2][0], 42);
+  EXPECT_EQ(&list[19], &pieces.storage[6][2]);
+
+  EXPECT_RUNTIME_FAIL(({
+    list[20];
+  }));
+}
+
+TEST(SpanListTests, FirstAndDropFirst) {
+  Pieces pieces{3, 4, 5};
+  auto list = pieces.List();
+
+  EXPECT_EQ(Collect(list.First(0)), std::vector<int>{});
+  EXPECT_EQ(list.First(0).SegmentCount(), 0u);
+  EXPECT_EQ(Collect(list.First(3)), Iota(0, 3));
+  EXPECT_EQ(list.First(3).SegmentCount(), 1u);
+  EXPECT_EQ(Collect(list.First(5)), Iota(0, 5));
+  EXPECT_EQ(list.First(5).SegmentCount(), 2u);
+  EXPECT_EQ(Collect(list.First(12)), Iota(0, 12));
+
+  EXPECT_EQ(Collect(list.DropFirst(0)), Iota(0, 12));
+  EXPECT_EQ(Collect(list.DropFirst(3)), Iota(3, 9));
+  EXPECT_EQ(list.DropFirst(3).SegmentCount(), 2u);
+  EXPECT_EQ(Collect(list.DropFirst(5)), Iota(5, 7));
+  EXPECT_EQ(list.DropFirst(5).Segments()[0].Data(), pieces.storage[1].data() + 2);
+  EXPECT_TRUE(list.DropFirst(12).Empty());
+  EXPECT_EQ(list.DropFirst(12).SegmentCount(), 0u);
+
+  // Both together cut out the middle
+  auto middle = list.DropFirst(2).First(8);
+  EXPECT_EQ(Collect(middle), Iota(2, 8));
+  EXPECT_EQ(middle.SegmentCount(), 3u);
+  EXPECT_EQ(middle[0], 2);
+  EXPECT_EQ(middle[7], 9);
+
+  EXPECT_RUNTIME_FAIL(({
+    list.First(13);
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    list.DropFirst(13);
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    list.DropFirst(12).First(0);
+  }));
+}
+
+TEST(SpanListTests, ManySegments) {
+  // More segments than fit inline
+  std::vector<int> data(1000);
+  std::iota(data.begin(), data.end(), 0);
+
+  SpanList<int, 2> list;
+  for (std::size_t from = 0; from < data.size(); from += 10) {
+    list.PushBack(Span<int>(data.data() + from, 10));
+  }
+  EXPECT_EQ(list.SegmentCount(), 100u);
+  EXPECT_EQ(list.Size(), 1000u);
+  EXPECT_EQ(list[537], 537);
+
+  auto copy = list;
+  EXPECT_EQ(Collect(copy), data);
+  EXPECT_EQ(&copy[999], &data[999]);
+
+  auto moved = std::move(copy);
+  EXPECT_EQ(Collect(moved.DropFirst(995)), Iota(995, 5));
+
+  list = moved.First(15);
+  EXPECT_EQ(list.SegmentCount(), 2u);
+  EXPECT_EQ(Collect(list), Iota(0, 15));
+}
+
+TEST(SpanListTests, SegmentLoops) {
+  Pieces pieces{100, 1, 250, 17};
+  auto list = pieces.List();
+
+  long long sum = 0;
+  for (Span<int> segment : list.Segments()) {
+    for (int x : segment) {
+      sum += x;
+    }
+  }
+  EXPECT_EQ(sum, 367ll * 368 / 2);
+  EXPECT_EQ(std::accumulate(list.begin(), list.end(), 0ll), sum);
+}
+
+#ifdef MPC_HAS_IOVEC
+
+TEST(SpanListTests, Iovecs) {
+  std::string_view header = "HTTP/1.1 200 OK\r\n\r\n";
+  std::string body = "hello, ";
+  std::array<char, 6> tail{'w', 'o', 'r', 'l', 'd', '\n'};
+
+  SpanList<const char> response{
+    Span<const char>(header.data(), header.size()),
+    Span<const char>(body.data(), body.size()),
+    Span<const char>(tail)};
+
+  std::array<iovec, 4> iovecs;
+  std::size_t count = response.ToIovecs(iovecs);
+  ASSERT_EQ(count, 3u);
+  EXPECT_EQ(iovecs[0].iov_base, header.data());
+  EXPECT_EQ(iovecs[1].iov_len, body.size());
+
+  int pipe_ends[2];
+  ASSERT_EQ(pipe(pipe_ends), 0);
+  ASSERT_EQ(writev(pipe_ends[1], iovecs.data(), static_cast<int>(count)), static_cast<ssize_t>(response.Size()));
+  close(pipe_ends[1]);
+
+  std::string received(response.Size(), '\0');
+  ASSERT_EQ(read(pipe_ends[0], received.data(), received.size()), static_cast<ssize_t>(received.size()));
+  close(pipe_ends[0]);
+  EXPECT_EQ(received, "HTTP/1.1 200 OK\r\n\r\nhello, world\n");
+
+  // Lengths are in bytes
+  std::vector<int> ints(10);
+  SpanList<int> list{Span<int>(ints)};
+  iovec one;
+  EXPECT_EQ(list.ToIovecs(std::span<iovec>(&one, 1)), 1u);
+  EXPECT_EQ(one.iov_len, 10 * sizeof(int));
+
+  EXPECT_RUNTIME_FAIL(({
+    response.ToIovecs(std::span(iovecs).first(2));
+  }));
+}
+
+#endif
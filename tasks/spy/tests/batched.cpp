@@ -0,0 +1,270 @@
+#include <testing/assert.hpp>
+#include <testing/RegularityWitness.hpp>
+
+#include "mocks.hpp"
+
+#include <Spy.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+namespace mpc::detail {
+
+using BatchLog = std::vector<ValueLog>;
+
+template <mpc::RegularityPolicy options>
+class BatchLogger : public mpc::RegularityWitness<options> {
+public:
+  explicit BatchLogger(BatchLog* got)
+    : got_(got) {}
+
+  void operator()(std::span<const unsigned int> batch) {
+    got_->emplace_back(batch.begin(), batch.end());
+  }
+
+private:
+  BatchLog* got_;
+};
+
+template <mpc::RegularityPolicy options>
+class BatchChecker {
+public:
+  BatchLogger<options> getLogger() {
+    return BatchLogger<options>{&got_};
+  }
+
+  BatchLog pollBatches() {
+    auto result = got_;
+    got_.clear();
+    return result;
+  }
+
+private:
+  BatchLog got_;
+};
+
+template <class Logger, class T, std::size_t capacity = 4>
+concept ProperBatchedLogger = requires(Spy<T>& spy, Logger&& logger) {
+  spy.setLogger(std::forward<Logger>(logger), Batched<capacity>{});
+};
+
+struct PlainLogger {
+  void operator()(unsigned int) {}
+};
+
+}
+
+TEST(SpyBatchedTest, StaticTests) {
+  using mpc::detail::BatchLogger;
+  using mpc::detail::Counter;
+  using mpc::detail::PlainLogger;
+  using mpc::detail::ProperBatchedLogger;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+  constexpr auto move_only_opt = mpc::RegularityPolicy{ .copy_constructor = false, .copy_assignment = false };
+  constexpr auto bad_destructor_opt = mpc::RegularityPolicy{ .nothrow_destructor = false };
+
+  static_assert(ProperBatchedLogger<BatchLogger<semiregular_opt>, Counter<semiregular_opt>>);
+  static_assert(ProperBatchedLogger<BatchLogger<semiregular_opt>, Counter<semiregular_opt>, 1>);
+  static_assert(!ProperBatchedLogger<BatchLogger<move_only_opt>, Counter<semiregular_opt>>);
+  static_assert(!ProperBatchedLogger<BatchLogger<bad_destructor_opt>, Counter<semiregular_opt>>);
+  static_assert(ProperBatchedLogger<BatchLogger<move_only_opt>, Counter<move_only_opt>>);
+
+  // Batched loggers take a span, not a single counter
+  static_assert(!ProperBatchedLogger<PlainLogger, Counter<semiregular_opt>>);
+}
+
+TEST(SpyBatchedTest, Threshold) {
+  using mpc::detail::BatchChecker;
+  using mpc::detail::BatchLog;
+  using mpc::detail::Counter;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+
+  auto s = Spy{ Counter<semiregular_opt>{} };
+  BatchChecker<semiregular_opt> checker;
+  s.setLogger(checker.getLogger(), Batched<4>{});
+  MPC_REQUIRE(eq, checker.pollBatches(), BatchLog{});
+
+  s->x = 0;
+  (void) (s->x++ + s->x++);
+  (s->x++, s->x++, s->x++);
+  MPC_REQUIRE(eq, checker.pollBatches(), BatchLog{});
+
+  s->isPositive() && s->x--;
+  MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1, 2, 3, 2}}));
+
+  for (int i = 0; i < 9; ++i) {
+    s->x++;
+  }
+  MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1, 1, 1, 1}, {1, 1, 1, 1}}));
+
+  s.flush();
+  MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1}}));
+
+  // Nothing to flush
+  s.flush();
+  MPC_REQUIRE(eq, checker.pollBatches(), BatchLog{});
+
+  // Accesses through operator* are never logged
+  (*s).x++;
+  s.flush();
+  MPC_REQUIRE(eq, checker.pollBatches(), BatchLog{});
+}
+
+TEST(SpyBatchedTest, NothingIsLost) {
+  using mpc::detail::BatchChecker;
+  using mpc::detail::BatchLog;
+  using mpc::detail::Counter;
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::ValueLog;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+
+  BatchChecker<semiregular_opt> checker;
+  LoggerChecker<semiregular_opt, 0> plainChecker;
+
+  {
+    auto s = Spy{ Counter<semiregular_opt>{} };
+    s.setLogger(checker.getLogger(), Batched<100>{});
+    s->x++;
+    (s->x++, s->x++);
+
+    // Replacing the logger flushes the old one
+    s.setLogger(plainChecker.getLogger());
+    MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1, 2}}));
+    s->x++;
+    MPC_REQUIRE(eq, plainChecker.pollValues(), ValueLog{1});
+
+    // flush() is a no-op for plain loggers
+    s.flush();
+    MPC_REQUIRE(eq, plainChecker.pollValues(), ValueLog{});
+
+    s.setLogger(checker.getLogger(), Batched<100>{});
+    s->x++;
+    MPC_REQUIRE(eq, checker.pollBatches(), BatchLog{});
+  }
+  // Destruction flushes too
+  MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1}}));
+
+  auto s = Spy{ Counter<semiregular_opt>{} };
+  s.setLogger(checker.getLogger(), Batched<100>{});
+  s->x++;
+
+  // Assignment flushes the overwritten logger
+  s = Spy{ Counter<semiregular_opt>{} };
+  MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1}}));
+}
+
+TEST(SpyBatchedTest, CopyAndMove) {
+  using mpc::detail::BatchChecker;
+  using mpc::detail::BatchLog;
+  using mpc::detail::Counter;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+  constexpr auto move_only_opt = mpc::RegularityPolicy{ .copy_constructor = false, .copy_assignment = false };
+
+  {
+    BatchChecker<semiregular_opt> checker;
+    auto s = Spy{ Counter<semiregular_opt>{} };
+    s.setLogger(checker.getLogger(), Batched<3>{});
+    (s->x++, s->x++);
+
+    // The copy starts with an empty buffer
+    auto copy = s;
+    copy->x++;
+    copy.flush();
+    MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1}}));
+
+    // Pending counters move together with the logger
+    auto moved = std::move(s);
+    moved->x++;
+    moved->x++;
+    MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{2, 1, 1}}));
+
+    decltype(moved) assigned;
+    moved->x++;
+    assigned = std::move(moved);
+    assigned.flush();
+    MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1}}));
+  }
+
+  {
+    BatchChecker<move_only_opt> checker;
+    auto s = Spy{ Counter<move_only_opt>{} };
+    s.setLogger(checker.getLogger(), Batched<2>{});
+    s->x++;
+    auto moved = std::move(s);
+    (moved->x++, moved->x++, moved->x++);
+    MPC_REQUIRE(eq, checker.pollBatches(), (BatchLog{{1, 3}}));
+  }
+}
+
+TEST(SpyBatchedTest, BackgroundConsumer) {
+  using mpc::detail::Counter;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+
+  struct Queue {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::vector<unsigned int>> batches;
+    bool done = false;
+  };
+
+  // Hands batches over to the consumer thread; the logging thread only copies them
+  struct QueueLogger {
+    Queue* queue;
+
+    void operator()(std::span<const unsigned int> batch) const {
+      {
+        std::lock_guard guard(queue->mutex);
+        queue->batches.emplace_back(batch.begin(), batch.end());
+      }
+      queue->ready.notify_one();
+    }
+  };
+
+  Queue queue;
+  unsigned long consumed = 0;
+  std::size_t batches = 0;
+  std::thread consumer([&] {
+    std::unique_lock lock(queue.mutex);
+    while (true) {
+      queue.ready.wait(lock, [&] { return queue.done || !queue.batches.empty(); });
+      while (!queue.batches.empty()) {
+        auto& batch = queue.batches.front();
+        consumed += std::accumulate(batch.begin(), batch.end(), 0ul);
+        ++batches;
+        queue.batches.pop_front();
+      }
+      if (queue.done) {
+        break;
+      }
+    }
+  });
+
+  {
+    auto s = Spy{ Counter<semiregular_opt>{} };
+    s.setLogger(QueueLogger{&queue}, Batched<64>{});
+    for (int i = 0; i < 10000; ++i) {
+      (s->x++, s->x++);
+    }
+  }
+
+  {
+    std::lock_guard guard(queue.mutex);
+    queue.done = true;
+  }
+  queue.ready.notify_one();
+  consumer.join();
+
+  EXPECT_EQ(consumed, 20000ul);
+  EXPECT_EQ(batches, (10000u + 63) / 64);
+}
@@ -0,0 +1,83 @@
+#include <Spy.hpp>
+
+#include <benchmark/benchmark.h>
+
+// The price of an access through operator->, with and without a logger,
+// against the plain object
+
+struct Point {
+  int x = 0;
+  int y = 0;
+
+  bool operator==(const Point&) const = default;
+};
+
+struct SumLogger {
+  unsigned int* total = nullptr;
+
+  void operator()(unsigned int accesses) const {
+    *total += accesses;
+  }
+
+  bool operator==(const SumLogger&) const = default;
+};
+
+constexpr int kExpressions = 1 << 10;
+
+void BM_Plain(benchmark::State& state) {
+  Point point;
+  for (auto _ : state) {
+    for (int i = 0; i < kExpressions; ++i) {
+      point.x += point.y + i;
+    }
+    benchmark::DoNotOptimize(point);
+  }
+  state.SetItemsProcessed(state.iterations() * kExpressions);
+}
+BENCHMARK(BM_Plain);
+
+void BM_NoLogger(benchmark::State& state) {
+  Spy<Point> spy;
+  for (auto _ : state) {
+    for (int i = 0; i < kExpressions; ++i) {
+      spy->x += spy->y + i;
+    }
+    benchmark::DoNotOptimize(*spy);
+  }
+  state.SetItemsProcessed(state.iterations() * kExpressions);
+}
+BENCHMARK(BM_NoLogger);
+
+void BM_Logger(benchmark::State& state) {
+  unsigned int total = 0;
+  Spy<Point> spy;
+  spy.setLogger(SumLogger{&total});
+  for (auto _ : state) {
+    for (int i = 0; i < kExpressions; ++i) {
+      spy->x += spy->y + i;
+    }
+    benchmark::DoNotOptimize(*spy);
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations() * kExpressions);
+}
+BENCHMARK(BM_Logger);
+
+// Profiling bonus: the same expressions with a clock read per expression
+template <class S>
+void BM_Profiled(benchmark::State& state) {
+  if constexpr (requires(S& spy) { spy.enableProfiling(); }) {
+    S spy;
+    spy.enableProfiling();
+    for (auto _ : state) {
+      for (int i = 0; i < kExpressions; ++i) {
+        spy->x += spy->y + i;
+      }
+      benchmark::DoNotOptimize(*spy);
+    }
+    state.SetItemsProcessed(state.iterations() * kExpressions);
+  } else {
+    state.SkipWithError("Spy has no profiling mode");
+  }
+}
+BENCHMARK(BM_Profiled<Spy<Point>>);
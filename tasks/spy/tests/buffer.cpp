@@ -0,0 +1,278 @@
+#include <testing/RegularityWitness.hpp>
+#include <testing/assert.hpp>
+#include <lib/arena.hpp>
+
+#include "mocks.hpp"
+
+#include <Spy.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+
+namespace {
+
+std::size_t globalNewCount = 0;
+
+constexpr std::size_t kDefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+void* countedAllocate(std::size_t size, std::size_t alignment) noexcept {
+  ++globalNewCount;
+  size = size == 0 ? 1 : size;
+  if (alignment <= kDefaultAlignment) {
+    return std::malloc(size);
+  }
+#if defined(_MSC_VER)
+  return _aligned_malloc(size, alignment);
+#else
+  // aligned_alloc wants the size to be a multiple of the alignment
+  return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void* countedAllocateOrThrow(std::size_t size, std::size_t alignment) {
+  if (void* p = countedAllocate(size, alignment)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+void countedFree(void* p, [[maybe_unused]] std::size_t alignment) noexcept {
+#if defined(_MSC_VER)
+  if (alignment > kDefaultAlignment) {
+    _aligned_free(p);
+    return;
+  }
+#endif
+  std::free(p);
+}
+
+}
+
+// Every allocation that bypasses the allocators in this test ends up here,
+// whichever form of new it goes through
+
+void* operator new(std::size_t size) {
+  return countedAllocateOrThrow(size, kDefaultAlignment);
+}
+
+void* operator new[](std::size_t size) {
+  return countedAllocateOrThrow(size, kDefaultAlignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return countedAllocate(size, kDefaultAlignment);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return countedAllocate(size, kDefaultAlignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* p, std::align_val_t alignment) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+  countedFree(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* p, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  countedFree(p, static_cast<std::size_t>(alignment));
+}
+
+namespace mpc::detail {
+
+struct alignas(64) OverAlignedLogger {
+  void operator()(unsigned int) {}
+};
+
+struct ThrowingMoveLogger {
+  ThrowingMoveLogger() = default;
+  ThrowingMoveLogger(const ThrowingMoveLogger&) = default;
+  ThrowingMoveLogger(ThrowingMoveLogger&&) noexcept(false) {}
+  ThrowingMoveLogger& operator=(const ThrowingMoveLogger&) = default;
+
+  void operator()(unsigned int) {}
+};
+
+}
+
+constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+using Value = mpc::detail::Counter<semiregular_opt>;
+
+// Logger<pad> holds a pointer and `pad` more bytes
+template <std::size_t pad>
+using PaddedLogger = mpc::detail::Logger<semiregular_opt, pad>;
+static_assert(sizeof(PaddedLogger<56>) == 64);
+static_assert(sizeof(PaddedLogger<88>) == 96);
+
+TEST(SpyBufferTest, Sizes) {
+  using Alloc = std::allocator<std::byte>;
+
+  static_assert(sizeof(Spy<char, Alloc, SmallBuffer<256>>) >= 256);
+  static_assert(sizeof(Spy<char, Alloc, SmallBuffer<64>>) < sizeof(Spy<char, Alloc, SmallBuffer<128>>));
+  static_assert(sizeof(Spy<char, Alloc, SmallBuffer<128>>) < sizeof(Spy<char, Alloc, SmallBuffer<256>>));
+  static_assert(alignof(Spy<char, Alloc, SmallBuffer<64, 64>>) >= 64);
+
+  static_assert(std::regular<Spy<int, Alloc, SmallBuffer<16>>>);
+  static_assert(std::copyable<Spy<Value, mpc::arena_allocator<std::byte>, SmallBuffer<128>>>);
+  static_assert(std::copyable<Spy<Value, mpc::pool_allocator<std::byte>, SmallBuffer<16>>>);
+}
+
+template <class Buffer, class Logger>
+std::size_t allocationsForLogger(Logger logger) {
+  using Alloc = mpc::detail::SpyAllocator<std::byte, false>;
+  Alloc::resetCounters();
+
+  Spy<Value, Alloc, Buffer> s;
+  s.setLogger(logger);
+  auto copy = s;
+  copy->x++;
+  return Alloc::allocationCount();
+}
+
+TEST(SpyBufferTest, Threshold) {
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::ValueLog;
+
+  LoggerChecker<semiregular_opt, 56> small;
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<64>>(small.getLogger()), std::size_t{0});
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<128>>(small.getLogger()), std::size_t{0});
+  MPC_REQUIRE(eq, small.pollValues(), (ValueLog{1, 1}));
+
+  // Does not fit, both setLogger and copy allocate
+  LoggerChecker<semiregular_opt, 64> medium;
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<64>>(medium.getLogger()), std::size_t{2});
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<72>>(medium.getLogger()), std::size_t{0});
+  MPC_REQUIRE(eq, medium.pollValues(), (ValueLog{1, 1}));
+
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<64, 64>>(mpc::detail::OverAlignedLogger{}), std::size_t{0});
+
+  MPC_REQUIRE(eq, allocationsForLogger<SmallBuffer<64>>(mpc::detail::ThrowingMoveLogger{}), std::size_t{2});
+}
+
+TEST(SpyBufferTest, ArenaCopiesWithoutOperatorNew) {
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::ValueLog;
+
+  using Alloc = mpc::arena_allocator<std::byte>;
+  using S = Spy<Value, Alloc, SmallBuffer<128>>;
+  using Vector = std::vector<S, mpc::arena_allocator<S>>;
+
+  alignas(std::max_align_t) static std::array<std::byte, 1 << 20> buffer;
+  mpc::monotonic_arena arena(buffer);
+
+  LoggerChecker<semiregular_opt, 88> checker;
+  Vector spies(mpc::arena_allocator<S>{arena});
+  spies.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    spies.emplace_back(Alloc{arena});
+    spies.back().setLogger(checker.getLogger());
+  }
+
+  const std::size_t before = globalNewCount;
+  Vector copy = spies;
+  const std::size_t after = globalNewCount;
+
+  for (auto& s : copy) {
+    s->x++;
+  }
+
+  EXPECT_EQ(after - before, 0u);
+  EXPECT_EQ(checker.pollValues(), ValueLog(100, 1));
+}
+
+TEST(SpyBufferTest, PoolCopiesWithoutOperatorNew) {
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::ValueLog;
+
+  using Alloc = mpc::pool_allocator<std::byte>;
+  // The logger never fits, so every Spy takes a block from the pool
+  using S = Spy<Value, Alloc, SmallBuffer<16>>;
+
+  alignas(std::max_align_t) static std::array<std::byte, 1 << 16> buffer;
+  mpc::block_pool pool(buffer, 128);
+  const std::size_t blocks = pool.available();
+
+  LoggerChecker<semiregular_opt, 88> checker;
+  std::vector<S> spies;
+  spies.reserve(100);
+  for (int i = 0; i < 50; ++i) {
+    spies.emplace_back(Alloc{pool});
+    spies.back().setLogger(checker.getLogger());
+  }
+  EXPECT_EQ(pool.available(), blocks - 50);
+
+  const std::size_t before = globalNewCount;
+  for (int i = 0; i < 50; ++i) {
+    spies.push_back(spies[i]);
+  }
+  spies.erase(spies.begin() + 25, spies.begin() + 50);
+  const std::size_t after = globalNewCount;
+
+  for (auto& s : spies) {
+    s->x++;
+  }
+
+  EXPECT_EQ(after - before, 0u);
+  EXPECT_EQ(pool.available(), blocks - 75);
+  EXPECT_EQ(checker.pollValues(), ValueLog(75, 1));
+
+  spies.clear();
+  EXPECT_EQ(pool.available(), blocks);
+}
@@ -0,0 +1,156 @@
+#include <testing/assert.hpp>
+#include <testing/RegularityWitness.hpp>
+
+#include "mocks.hpp"
+
+#include <Spy.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+using Semiregular = mpc::RegularityWitness<mpc::RegularityPolicy{}>;
+using NoCopy = mpc::RegularityWitness<mpc::RegularityPolicy{ .copy_constructor = false, .copy_assignment = false }>;
+using NoMove = mpc::RegularityWitness<mpc::RegularityPolicy{ .move_constructor = false, .move_assignment = false }>;
+
+static_assert(std::regular<ConcurrentSpy<int>>);
+static_assert(std::semiregular<ConcurrentSpy<Semiregular>>);
+static_assert(!std::regular<ConcurrentSpy<Semiregular>>);
+static_assert(std::movable<ConcurrentSpy<NoCopy>>);
+static_assert(!std::copyable<ConcurrentSpy<NoCopy>>);
+static_assert(std::semiregular<ConcurrentSpy<NoMove>>);
+
+struct Hits {
+  std::atomic<std::uint64_t>* total;
+
+  void hit() {
+    total->fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+struct Sink {
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> logged{0};
+  std::atomic<bool> unexpectedCount{false};
+};
+
+// Accesses logged on the current thread
+thread_local std::uint64_t loggedHere = 0;
+
+struct SinkLogger {
+  Sink* sink;
+  unsigned int expected;
+
+  void operator()(unsigned int n) const {
+    loggedHere += n;
+    sink->calls.fetch_add(1, std::memory_order_relaxed);
+    sink->logged.fetch_add(n, std::memory_order_relaxed);
+    if (n != expected) {
+      sink->unexpectedCount.store(true, std::memory_order_relaxed);
+    }
+  }
+};
+
+}  // namespace
+
+TEST(ConcurrentSpyTest, SingleThread) {
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::Counter;
+  using mpc::detail::ValueLog;
+
+  constexpr auto semiregular_opt = mpc::RegularityPolicy{};
+
+  auto s = ConcurrentSpy{ Counter<semiregular_opt>(1) };
+  MPC_REQUIRE(eq, s->x, 1);
+
+  LoggerChecker<semiregular_opt, 0> checker;
+  s.setLogger(checker.getLogger());
+
+  s->x = 0;
+  s->isPositive() && s->x--;
+  MPC_REQUIRE(eq, checker.pollValues(), ValueLog{1, 1});
+
+  (void) (s->x++ + s->x++);
+  MPC_REQUIRE(eq, checker.pollValues(), ValueLog{2});
+
+  auto s2 = s;
+  (s2->x++, s->x++, s2->x++);
+  MPC_REQUIRE(eq, checker.pollValues(), ValueLog{1, 2});
+
+  s2 = std::move(s);
+  s2->x++;
+  MPC_REQUIRE(eq, checker.pollValues(), ValueLog{1});
+}
+
+TEST(ConcurrentSpyTest, ManyThreads) {
+  constexpr std::uint64_t kIterations = 10000;
+
+  for (std::size_t threads : {1, 2, 4, 8, 16}) {
+    std::atomic<std::uint64_t> total{0};
+    Sink sink;
+
+    ConcurrentSpy<Hits> spy{Hits{&total}};
+    spy.setLogger(SinkLogger{&sink, 3});
+
+    std::atomic<std::size_t> wrongThread{0};
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([&] {
+        loggedHere = 0;
+        for (std::uint64_t it = 0; it < kIterations; ++it) {
+          (spy->hit(), spy->hit(), spy->hit());
+        }
+        // Every access of this thread is reported on this thread
+        if (loggedHere != 3 * kIterations) {
+          wrongThread.fetch_add(1);
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    EXPECT_EQ(total.load(), 3 * kIterations * threads);
+    EXPECT_EQ(sink.calls.load(), kIterations * threads) << threads << " threads";
+    EXPECT_EQ(sink.logged.load(), 3 * kIterations * threads) << threads << " threads";
+    EXPECT_FALSE(sink.unexpectedCount.load()) << threads << " threads";
+    EXPECT_EQ(wrongThread.load(), 0u) << threads << " threads";
+  }
+}
+
+TEST(ConcurrentSpyTest, IndependentSpies) {
+  constexpr std::uint64_t kIterations = 10000;
+  constexpr std::size_t kThreads = 8;
+
+  std::atomic<std::uint64_t> total{0};
+  Sink sinkA;
+  Sink sinkB;
+
+  ConcurrentSpy<Hits> a{Hits{&total}};
+  ConcurrentSpy<Hits> b{Hits{&total}};
+  a.setLogger(SinkLogger{&sinkA, 2});
+  b.setLogger(SinkLogger{&sinkB, 1});
+
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < kThreads; ++i) {
+    workers.emplace_back([&] {
+      for (std::uint64_t it = 0; it < kIterations; ++it) {
+        // Counters of different spies do not mix even within one expression
+        (a->hit(), b->hit(), a->hit());
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(total.load(), 3 * kIterations * kThreads);
+  EXPECT_EQ(sinkA.calls.load(), kIterations * kThreads);
+  EXPECT_EQ(sinkB.calls.load(), kIterations * kThreads);
+  EXPECT_FALSE(sinkA.unexpectedCount.load());
+  EXPECT_FALSE(sinkB.unexpectedCount.load());
+}
@@ -0,0 +1,64 @@
+#include <Spy.hpp>
+
+#include <benchmark/benchmark.h>
+
+// operator-> of one ConcurrentSpy shared by 1..64 threads against a Spy of
+// each thread's own: a plain Spy cannot be shared, and the thread_local
+// counters should make the difference small and independent of the
+// number of threads
+
+struct Point {
+  int x = 0;
+  int y = 0;
+
+  bool operator==(const Point&) const = default;
+};
+
+// Has no shared state, so it does not serialize the threads by itself
+struct DiscardLogger {
+  void operator()(unsigned int accesses) const {
+    benchmark::DoNotOptimize(accesses);
+  }
+
+  bool operator==(const DiscardLogger&) const = default;
+};
+
+constexpr int kExpressions = 1 << 10;
+
+// The threads only read the object, T is theirs to synchronize
+template <class S>
+void ReadExpressions(benchmark::State& state, S& spy) {
+  for (auto _ : state) {
+    int sum = 0;
+    for (int i = 0; i < kExpressions; ++i) {
+      sum += spy->x + spy->y + i;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kExpressions);
+}
+
+void BM_SpyPerThread(benchmark::State& state) {
+  Spy<Point> spy;
+  spy.setLogger(DiscardLogger{});
+  ReadExpressions(state, spy);
+}
+BENCHMARK(BM_SpyPerThread)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_ConcurrentSpyPerThread(benchmark::State& state) {
+  ConcurrentSpy<Point> spy;
+  spy.setLogger(DiscardLogger{});
+  ReadExpressions(state, spy);
+}
+BENCHMARK(BM_ConcurrentSpyPerThread)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_ConcurrentSpyShared(benchmark::State& state) {
+  // Initialized once, by whichever benchmark thread gets here first
+  static ConcurrentSpy<Point> spy = [] {
+    ConcurrentSpy<Point> result;
+    result.setLogger(DiscardLogger{});
+    return result;
+  }();
+  ReadExpressions(state, spy);
+}
+BENCHMARK(BM_ConcurrentSpyShared)->ThreadRange(1, 64)->UseRealTime();
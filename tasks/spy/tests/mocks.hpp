@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 
@@ -62,4 +64,54 @@ struct Counter : public mpc::RegularityWitness<options> {
   Counter() {}
 };
 
+template<class T, bool reallocate>
+class SpyAllocator : private std::allocator<T> {
+public:
+  SpyAllocator() = default;
+  SpyAllocator(std::size_t id) : id_{id} {}
+
+  friend bool operator==(const SpyAllocator&, const SpyAllocator&) = default;
+
+  using propagate_on_container_copy_assignment = std::integral_constant<bool, !reallocate>;
+  using propagate_on_container_move_assignment = std::integral_constant<bool, !reallocate>;
+
+  using value_type = T;
+
+  template<class U>
+  struct rebind { using other = SpyAllocator<U, reallocate>; };
+
+  [[nodiscard]] constexpr T* allocate(std::size_t n) {
+    ++allocationCounter_;
+    return std::allocator_traits<std::allocator<T>>::allocate(*this, n);
+  }
+
+  constexpr void deallocate(T* p, std::size_t n) {
+    return std::allocator_traits<std::allocator<T>>::deallocate(*this, p, n);
+  }
+
+  template<class U, class... Args>
+  constexpr void construct(U* p, Args&&... args) {
+    ++placementCounter_;
+    std::allocator_traits<std::allocator<T>>::template construct<U>(*this, p, std::forward<Args>(args)...);
+  }
+
+  template<class U>
+  constexpr void destroy(U* p) {
+    std::allocator_traits<std::allocator<T>>::template destroy<U>(*this, p);
+  }
+
+  static void resetCounters() {
+    allocationCounter_ = 0;
+    placementCounter_ = 0;
+  }
+
+  static std::size_t allocationCount() { return allocationCounter_; }
+  static std::size_t placementCount() { return placementCounter_; }
+
+private:
+  std::size_t id_ = 0;
+  inline static std::size_t allocationCounter_ = 0;
+  inline static std::size_t placementCounter_ = 0;
+};
+
 }
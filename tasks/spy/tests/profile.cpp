@@ -0,0 +1,202 @@
+#include <testing/assert.hpp>
+
+#include "mocks.hpp"
+
+#include <Spy.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+// Only moves when told to
+template <class Period>
+struct ManualClock {
+  using rep = std::int64_t;
+  using period = Period;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<ManualClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() noexcept {
+    return time_point{duration{ticks}};
+  }
+
+  inline static rep ticks = 0;
+};
+
+using NanoClock = ManualClock<std::nano>;
+using MicroClock = ManualClock<std::micro>;
+
+struct Worker {
+  int x = 0;
+
+  template <class Clock = NanoClock>
+  void work(std::int64_t ticks) {
+    Clock::ticks += ticks;
+  }
+};
+
+using Buckets = std::vector<ProfileHistogram::Bucket>;
+
+}  // namespace
+
+TEST(SpyProfileTest, Histograms) {
+  Spy<Worker> s;
+  s.enableProfiling<NanoClock>();
+
+  s->work(100);
+  (s->work(5), s->work(7));
+  s->x++;
+
+  ProfileSnapshot profile = s.profile();
+  MPC_REQUIRE(eq, profile.expressions, 3u);
+  MPC_REQUIRE(eq, profile.accesses, 4u);
+
+  MPC_REQUIRE(eq, profile.accessesPerExpression.count(), 3u);
+  MPC_REQUIRE(eq, profile.accessesPerExpression.buckets(), (Buckets{{1, 2, 2}, {2, 3, 1}}));
+
+  // Four buckets per octave: 12 in [12, 14), 100 in [96, 112)
+  MPC_REQUIRE(eq, profile.nanoseconds.count(), 3u);
+  MPC_REQUIRE(eq, profile.nanoseconds.buckets(), (Buckets{{0, 1, 1}, {12, 14, 1}, {96, 112, 1}}));
+}
+
+TEST(SpyProfileTest, Percentiles) {
+  Spy<Worker> s;
+  s.enableProfiling<NanoClock>();
+  MPC_REQUIRE(eq, s.profile().nanoseconds.percentile(0.5), 0u);
+
+  for (int i = 1; i <= 100; ++i) {
+    s->work(i);
+  }
+
+  ProfileHistogram nanoseconds = s.profile().nanoseconds;
+  MPC_REQUIRE(eq, nanoseconds.count(), 100u);
+  MPC_REQUIRE(eq, nanoseconds.percentile(0), 1u);
+  // 1..55 are at or below [48, 56), 1..47 are not enough
+  MPC_REQUIRE(eq, nanoseconds.percentile(0.5), 55u);
+  MPC_REQUIRE(eq, nanoseconds.percentile(1), 111u);
+}
+
+TEST(SpyProfileTest, Units) {
+  Spy<Worker> s;
+  s.enableProfiling<MicroClock>();
+
+  s->work<MicroClock>(3);
+
+  // 3000 ns, the octave [2048, 4096) has buckets of 512
+  MPC_REQUIRE(eq, s.profile().nanoseconds.buckets(), (Buckets{{2560, 3072, 1}}));
+}
+
+TEST(SpyProfileTest, LoggerStillWorks) {
+  using mpc::detail::LoggerChecker;
+  using mpc::detail::ValueLog;
+
+  LoggerChecker<mpc::RegularityPolicy{}, 0> checker;
+  Spy<Worker> s;
+  s.setLogger(checker.getLogger());
+  s.enableProfiling<NanoClock>();
+
+  (s->work(1), s->x++);
+  s->x++;
+  MPC_REQUIRE(eq, checker.pollValues(), (ValueLog{2, 1}));
+  MPC_REQUIRE(eq, s.profile().accesses, 3u);
+
+  // Replacing the logger keeps the profile
+  LoggerChecker<mpc::RegularityPolicy{}, 0> another;
+  s.setLogger(another.getLogger());
+  s->x++;
+  MPC_REQUIRE(eq, another.pollValues(), (ValueLog{1}));
+  MPC_REQUIRE(eq, s.profile().expressions, 3u);
+}
+
+TEST(SpyProfileTest, ResetAndDisable) {
+  Spy<Worker> s;
+  MPC_REQUIRE(eq, s.profile().expressions, 0u);
+
+  s.enableProfiling<NanoClock>();
+  s->x++;
+  s->x++;
+  MPC_REQUIRE(eq, s.profile().expressions, 2u);
+
+  s.resetProfile();
+  MPC_REQUIRE(eq, s.profile().expressions, 0u);
+  MPC_REQUIRE(eq, s.profile().nanoseconds.count(), 0u);
+
+  s->x++;
+  MPC_REQUIRE(eq, s.profile().expressions, 1u);
+
+  s.disableProfiling();
+  s->x++;
+  MPC_REQUIRE(eq, s.profile().expressions, 0u);
+  MPC_REQUIRE(eq, s->x, 4);
+}
+
+TEST(SpyProfileTest, CopyAndMove) {
+  Spy<Worker> s;
+  s.enableProfiling<NanoClock>();
+  s->work(10);
+
+  // A copy starts from scratch, with the same clock
+  Spy<Worker> copy = s;
+  MPC_REQUIRE(eq, copy.profile().expressions, 0u);
+  copy->work(20);
+  MPC_REQUIRE(eq, copy.profile().nanoseconds.buckets(), (Buckets{{20, 24, 1}}));
+  MPC_REQUIRE(eq, s.profile().expressions, 1u);
+
+  // The profile moves with the Spy
+  Spy<Worker> moved = std::move(s);
+  moved->work(10);
+  MPC_REQUIRE(eq, moved.profile().nanoseconds.buckets(), (Buckets{{10, 12, 2}}));
+
+  copy = moved;
+  MPC_REQUIRE(eq, copy.profile().expressions, 0u);
+  copy->x++;
+  MPC_REQUIRE(eq, copy.profile().expressions, 1u);
+}
+
+TEST(SpyProfileTest, DefaultClock) {
+  Spy<Worker> s;
+  s.enableProfiling();
+
+  for (int i = 0; i < 10; ++i) {
+    s->x++;
+  }
+  MPC_REQUIRE(eq, s.profile().expressions, 10u);
+  MPC_REQUIRE(eq, s.profile().nanoseconds.count(), 10u);
+}
+
+TEST(SpyProfileTest, SnapshotWhileRunning) {
+  constexpr std::uint64_t kExpressions = 100'000;
+
+  Spy<Worker> s;
+  s.enableProfiling<NanoClock>();
+
+  std::atomic<bool> done{false};
+  std::atomic<bool> wentBack{false};
+  std::thread reader([&] {
+    std::uint64_t last = 0;
+    while (!done.load()) {
+      ProfileSnapshot profile = s.profile();
+      if (profile.expressions < last || profile.accesses > kExpressions) {
+        wentBack.store(true);
+      }
+      last = profile.expressions;
+    }
+  });
+
+  for (std::uint64_t i = 0; i < kExpressions; ++i) {
+    s->x++;
+  }
+  done.store(true);
+  reader.join();
+
+  MPC_REQUIRE(eq, wentBack.load(), false);
+  MPC_REQUIRE(eq, s.profile().expressions, kExpressions);
+  MPC_REQUIRE(eq, s.profile().accessesPerExpression.buckets(), (Buckets{{1, 2, kExpressions}}));
+}
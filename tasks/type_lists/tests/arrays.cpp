@@ -0,0 +1,101 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+
+using type_tuples::TTuple;
+using value_types::ValueTag;
+
+using type_lists::FromTuple;
+using type_lists::LookupTable;
+using type_lists::Nil;
+using type_lists::Take;
+using type_lists::ToArray;
+
+
+// TO ARRAY
+
+static_assert(std::same_as<decltype(ToArray<Take<5, Nats>>), const std::array<int, 5>>);
+static_assert(ToArray<Take<5, Nats>> == std::array{0, 1, 2, 3, 4});
+static_assert(ToArray<Take<10, Fib>>[9] == 34);
+static_assert(ToArray<Take<200, Nats>>[199] == 199);
+
+static_assert(std::same_as<decltype(ToArray<Take<3, Nats>, long long>), const std::array<long long, 3>>);
+static_assert(ToArray<Take<3, Nats>, long long>[2] == 2);
+
+static_assert(std::same_as<decltype(ToArray<Nil, int>), const std::array<int, 0>>);
+
+// The common type of the values
+using Mixed = FromTuple<TTuple<ValueTag<1>, ValueTag<2u>, ValueTag<3LL>>>;
+static_assert(std::same_as<decltype(ToArray<Mixed>)::value_type, long long>);
+static_assert(ToArray<Mixed> == std::array<long long, 3>{1, 2, 3});
+
+// LOOKUP TABLE
+
+using FibTable = LookupTable<Take<45, Fib>>;
+
+static_assert(FibTable::size == 45);
+static_assert(std::same_as<FibTable::value_type, int>);
+static_assert(FibTable{}[10] == 55);
+static_assert(FibTable{}[44] == 701408733);
+
+// No copies of the array anywhere
+static_assert(&FibTable::values == &ToArray<Take<45, Fib>>);
+static_assert(FibTable::AsSpan().data() == ToArray<Take<45, Fib>>.data());
+static_assert(FibTable::AsSpan().size() == 45);
+
+static_assert(LookupTable<Nil, int>::size == 0);
+static_assert(LookupTable<Nil, int>::AsSpan().empty());
+
+// Nothing to initialize at startup
+constinit FibTable kFib;
+
+TEST(ArraysTest, RuntimeIndexing) {
+  int previous = 0;
+  int current = 1;
+  EXPECT_EQ(kFib[0], 0);
+  for (std::size_t i = 1; i < FibTable::size; ++i) {
+    EXPECT_EQ(kFib[i], current);
+    current = std::exchange(previous, current) + current;
+  }
+
+  volatile std::size_t index = 40;
+  EXPECT_EQ(kFib[index], 102334155);
+  EXPECT_EQ(&kFib[index], &FibTable::values[40]);
+}
+
+TEST(ArraysTest, BoundsChecked) {
+  EXPECT_RUNTIME_FAIL(({
+    kFib[45];
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    LookupTable<Nil, int>{}[0];
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    kFib[44];
+  }));
+}
+
+TEST(ArraysTest, Primes) {
+  LookupTable<Take<100, Primes>> primes;
+  EXPECT_EQ(primes[0], 2);
+  EXPECT_EQ(primes[99], 541);
+
+  std::span<const int> span = primes.AsSpan();
+  EXPECT_TRUE(std::ranges::binary_search(span, 97));
+  EXPECT_FALSE(std::ranges::binary_search(span, 91));
+  EXPECT_EQ(std::ranges::lower_bound(span, 100) - span.begin(), 25);
+}
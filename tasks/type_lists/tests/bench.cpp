@@ -0,0 +1,107 @@
+#include <type_lists.hpp>
+#include <fun_value_sequences.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// A LookupTable is one load from a constant array, whatever it took the
+// compiler to fill it; computing the same values at runtime is not
+
+using FibTable = type_lists::LookupTable<type_lists::Take<45, Fib>>;
+using PrimeTable = type_lists::LookupTable<type_lists::Take<1000, Primes>>;
+
+constexpr std::size_t kQueries = 1 << 12;
+
+std::vector<int> MakeQueries(int bound) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, bound - 1);
+  std::vector<int> queries(kQueries);
+  for (int& query : queries) {
+    query = distribution(generator);
+  }
+  return queries;
+}
+
+int FibLoop(int n) {
+  int previous = 0;
+  int current = 1;
+  for (int i = 0; i < n; ++i) {
+    current = previous + current;
+    previous = current - previous;
+  }
+  return previous;
+}
+
+bool IsPrime(int n) {
+  for (int d = 2; d * d <= n; ++d) {
+    if (n % d == 0) {
+      return false;
+    }
+  }
+  return n > 1;
+}
+
+// Counting from zero, NthPrime(0) == 2
+int NthPrime(int n) {
+  int candidate = 1;
+  for (int found = -1; found < n;) {
+    found += IsPrime(++candidate);
+  }
+  return candidate;
+}
+
+void BM_FibTable(benchmark::State& state) {
+  auto queries = MakeQueries(FibTable::size);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (int query : queries) {
+      sum += FibTable{}[query];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_FibTable);
+
+void BM_FibLoop(benchmark::State& state) {
+  auto queries = MakeQueries(FibTable::size);
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (int query : queries) {
+      sum += FibLoop(query);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_FibLoop);
+
+void BM_PrimeTable(benchmark::State& state) {
+  auto queries = MakeQueries(PrimeTable::size);
+  for (auto _ : state) {
+    int sum = 0;
+    for (int query : queries) {
+      sum += PrimeTable{}[query];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_PrimeTable);
+
+void BM_TrialDivision(benchmark::State& state) {
+  auto queries = MakeQueries(PrimeTable::size);
+  for (auto _ : state) {
+    int sum = 0;
+    for (int query : queries) {
+      sum += NthPrime(query);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_TrialDivision);
@@ -0,0 +1,47 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+
+#include <cstddef>
+
+// Compile-time benchmark, see make_compile_bench: every step below walks
+// LENGTH elements of a lazy list
+
+#ifndef LENGTH
+#define LENGTH 1000
+#endif
+
+using type_lists::Drop;
+using type_lists::Filter;
+using type_lists::Map;
+using type_lists::Scanl;
+using type_lists::Take;
+using type_lists::ToTuple;
+
+template<class T>
+using Twice = value_types::ValueTag<2 * T::Value>;
+
+template<class T>
+struct Odd { static constexpr bool Value = T::Value % 2 == 1; };
+
+template<class L, class R>
+struct Plus { using Type = value_types::ValueTag<L::Value + R::Value>; };
+
+constexpr std::size_t kLength = LENGTH;
+
+static_assert(Drop<kLength - 1, Nats>::Head::Value == kLength - 1);
+static_assert(Drop<kLength - 1, Map<Twice, Nats>>::Head::Value == 2 * (kLength - 1));
+static_assert(Drop<kLength - 1, Filter<Odd, Nats>>::Head::Value == 2 * kLength - 1);
+static_assert(Drop<kLength, Scanl<Plus, value_types::ValueTag<std::size_t{0}>, Nats>>::Head::Value
+  == kLength * (kLength - 1) / 2);
+
+// Fib soon overflows int, so it is only walked as far as arrays.cpp takes it
+constexpr std::size_t kFibLength = kLength < 45 ? kLength : 45;
+static_assert(Drop<kFibLength - 1, Fib>::Head::Value
+  == Drop<kFibLength - 2, Fib>::Head::Value + Drop<kFibLength - 3, Fib>::Head::Value);
+
+// Takes minutes past LENGTH = 1000 without the sieve bonus
+static_assert(Drop<kLength - 1, Primes>::Head::Value > Drop<kLength - 2, Primes>::Head::Value);
+
+using Prefix = ToTuple<Take<kLength, Nats>>;
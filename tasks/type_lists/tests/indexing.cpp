@@ -0,0 +1,131 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+#include <lib/indexing.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+// course/lib/indexing.hpp on the lists of this task. Everything here must
+// compile with the default -ftemplate-depth.
+
+
+using type_tuples::TTuple;
+using value_types::ValueTag;
+
+using type_lists::FromTuple;
+using type_lists::Take;
+using type_lists::ToTuple;
+
+using mpc::index_of_v;
+using mpc::pack_member;
+using mpc::pack_size_v;
+using mpc::sequence_at_t;
+using mpc::sequence_drop_t;
+using mpc::type_at_t;
+using mpc::type_pack;
+using mpc::type_sequence;
+using mpc::types;
+
+
+template<class Seq>
+struct TagsImpl;
+
+template<std::size_t... is>
+struct TagsImpl<std::index_sequence<is...>> {
+  using type = TTuple<ValueTag<is>...>;
+};
+
+template<std::size_t n>
+using Tags = typename TagsImpl<std::make_index_sequence<n>>::type;
+
+
+// PACKS
+
+static_assert(type_pack<types<>>);
+static_assert(type_pack<TTuple<int, char>>);
+static_assert(type_pack<std::tuple<int>>);
+static_assert(!type_pack<int>);
+
+static_assert(pack_size_v<types<>> == 0);
+static_assert(pack_size_v<TTuple<int, char, int>> == 3);
+
+static_assert(std::same_as<type_at_t<0, types<int, char, int>>, int>);
+static_assert(std::same_as<type_at_t<1, types<int, char, int>>, char>);
+static_assert(std::same_as<type_at_t<2, TTuple<int, char, bool>>, bool>);
+static_assert(std::same_as<type_at_t<0, std::tuple<int&, const int>>, int&>);
+static_assert(std::same_as<type_at_t<1, std::tuple<int&, const int>>, const int>);
+
+// Past the end is not an error inside the alias but a failed constraint
+template<std::size_t I, class Pack>
+concept Indexable = requires { typename type_at_t<I, Pack>; };
+
+static_assert(Indexable<2, types<int, char, int>>);
+static_assert(!Indexable<3, types<int, char, int>>);
+static_assert(!Indexable<0, types<>>);
+
+static_assert(index_of_v<int, types<int, char, int>> == 0);
+static_assert(index_of_v<char, types<int, char, int>> == 1);
+static_assert(index_of_v<bool, types<int, char, int>> == 3);
+static_assert(index_of_v<bool, types<>> == 0);
+static_assert(index_of_v<const int, types<int, const int>> == 1);
+
+static_assert(pack_member<char, types<int, char>>);
+static_assert(!pack_member<bool, types<int, char>>);
+static_assert(!pack_member<int, types<>>);
+
+// Long packs, one instantiation per element would not fit
+using Long = Tags<5000>;
+
+static_assert(pack_size_v<Long> == 5000);
+static_assert(std::same_as<type_at_t<0, Long>, ValueTag<std::size_t{0}>>);
+static_assert(std::same_as<type_at_t<2500, Long>, ValueTag<std::size_t{2500}>>);
+static_assert(std::same_as<type_at_t<4999, Long>, ValueTag<std::size_t{4999}>>);
+static_assert(index_of_v<ValueTag<std::size_t{3141}>, Long> == 3141);
+static_assert(index_of_v<int, Long> == 5000);
+
+// What ToTuple of this task gives is a pack as well
+static_assert(type_at_t<7, ToTuple<Take<10, Nats>>>::Value == 7);
+static_assert(type_at_t<9, ToTuple<Take<10, Fib>>>::Value == 34);
+static_assert(index_of_v<ValueTag<13>, ToTuple<Take<10, Fib>>> == 7);
+
+
+// SEQUENCES
+
+static_assert(type_sequence<Nats>);
+static_assert(!type_sequence<type_lists::Nil>);
+static_assert(!type_sequence<types<int>>);
+
+static_assert(std::same_as<mpc::chunked<Nats, 4>::Head, types<ValueTag<0>, ValueTag<1>, ValueTag<2>, ValueTag<3>>>);
+static_assert(std::same_as<mpc::chunked<Nats, 4>::Tail::Head, types<ValueTag<4>, ValueTag<5>, ValueTag<6>, ValueTag<7>>>);
+
+// The last chunk of a finite list is shorter, then the chunks end as well
+using Five = FromTuple<TTuple<int, char, bool, long, short>>;
+
+static_assert(std::same_as<mpc::chunked<Five, 2>::Tail::Tail::Head, types<short>>);
+static_assert(!type_sequence<mpc::chunked<Five, 2>::Tail::Tail::Tail>);
+static_assert(!type_sequence<mpc::chunked<Five, 5>::Tail>);
+
+static_assert(std::same_as<sequence_at_t<0, Five, 2>, int>);
+static_assert(std::same_as<sequence_at_t<3, Five, 2>, long>);
+static_assert(std::same_as<sequence_at_t<4, Five, 2>, short>);
+static_assert(!type_sequence<sequence_drop_t<5, Five, 2>>);
+static_assert(!type_sequence<sequence_drop_t<100, Five, 2>>);
+
+template<std::size_t I, class TL>
+concept SequenceIndexable = requires { typename sequence_at_t<I, TL>; };
+
+static_assert(SequenceIndexable<4, Five>);
+static_assert(!SequenceIndexable<5, Five>);
+
+static_assert(sequence_at_t<0, Nats>::Value == 0);
+static_assert(sequence_at_t<63, Nats>::Value == 63);
+static_assert(sequence_at_t<64, Nats>::Value == 64);
+static_assert(sequence_at_t<5000, Nats>::Value == 5000);
+static_assert(sequence_at_t<44, Fib>::Value == 701408733);
+
+static_assert(std::same_as<sequence_drop_t<3000, Nats>::Head, sequence_at_t<3000, Nats>>);
+static_assert(sequence_drop_t<3000, Nats>::Tail::Head::Value == 3001);
@@ -0,0 +1,60 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <lib/indexing.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+// Compile-time benchmark, see make_compile_bench: every element of a list
+// of kLength types is looked up by its index in one of the ways below,
+// the way Describe and codegen look them up over and over:
+//   ACCESS=drop     -- Drop<I, TL>::Head of this task, the element by
+//                      element walk unless Drop walks by chunks;
+//   ACCESS=chunked  -- mpc::sequence_at_t, chunked walk over the same list;
+//   ACCESS=type_at  -- mpc::type_at_t on the TTuple itself.
+
+#ifndef ACCESS
+#define ACCESS type_at
+#endif
+
+#define BENCH_KIND(kind) BENCH_KIND_IMPL(kind)
+#define BENCH_KIND_IMPL(kind) BENCH_KIND_##kind
+#define BENCH_KIND_drop 1
+#define BENCH_KIND_chunked 2
+#define BENCH_KIND_type_at 3
+
+constexpr std::size_t kLength = 1001;
+
+template<class Seq>
+struct TagsImpl;
+
+template<std::size_t... is>
+struct TagsImpl<std::index_sequence<is...>> {
+  using type = type_tuples::TTuple<value_types::ValueTag<is>...>;
+};
+
+using Tuple = typename TagsImpl<std::make_index_sequence<kLength>>::type;
+using List = type_lists::FromTuple<Tuple>;
+
+#if BENCH_KIND(ACCESS) == BENCH_KIND_drop
+template<std::size_t I>
+using At = typename type_lists::Drop<I, List>::Head;
+#elif BENCH_KIND(ACCESS) == BENCH_KIND_chunked
+template<std::size_t I>
+using At = mpc::sequence_at_t<I, List>;
+#elif BENCH_KIND(ACCESS) == BENCH_KIND_type_at
+template<std::size_t I>
+using At = mpc::type_at_t<I, Tuple>;
+#else
+#error "ACCESS must be one of drop, chunked and type_at"
+#endif
+
+template<std::size_t... is>
+constexpr bool AllAt(std::index_sequence<is...>) {
+  return (std::same_as<At<is>, value_types::ValueTag<is>> && ...);
+}
+
+// Up to I = 1000
+static_assert(AllAt(std::make_index_sequence<kLength>{}));
@@ -0,0 +1,143 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+// Everything here must compile with the default -ftemplate-depth,
+// so walking a list one element per nested instantiation won't do.
+
+
+using type_tuples::TTuple;
+using value_types::VTuple;
+
+using type_lists::ToTuple;
+using type_lists::FromTuple;
+using type_lists::Take;
+using type_lists::Drop;
+using type_lists::Map;
+using type_lists::Filter;
+using type_lists::Repeat;
+using type_lists::Replicate;
+using type_lists::Cycle;
+using type_lists::Chunks;
+using type_lists::Scanl;
+using type_lists::Zip2;
+using type_lists::Inits;
+using type_lists::Tails;
+using type_lists::Nil;
+
+
+template<int from, class Seq>
+struct RangeImpl;
+
+template<int from, int... is>
+struct RangeImpl<from, std::integer_sequence<int, is...>> {
+  using type = VTuple<int, (from + is)...>;
+};
+
+// [from, from + count)
+template<int from, int count>
+using Range = typename RangeImpl<from, std::make_integer_sequence<int, count>>::type;
+
+template<class T, class Seq>
+struct ReplicatedImpl;
+
+template<class T, std::size_t... is>
+struct ReplicatedImpl<T, std::index_sequence<is...>> {
+  template<std::size_t>
+  using Same = T;
+
+  using type = TTuple<Same<is>...>;
+};
+
+template<std::size_t n, class T>
+using Replicated = typename ReplicatedImpl<T, std::make_index_sequence<n>>::type;
+
+template<class T>
+using Twice = value_types::ValueTag<2 * T::Value>;
+
+template<class T>
+struct Odd { static constexpr bool Value = T::Value % 2 == 1; };
+
+template<class L, class R>
+struct Plus { using Type = value_types::ValueTag<L::Value + R::Value>; };
+
+
+// CHUNKS
+
+static_assert(
+  std::same_as
+  < ToTuple<Take<3, Chunks<4, Nats>>>
+  , TTuple<Range<0, 4>, Range<4, 4>, Range<8, 4>>
+  >);
+
+static_assert(
+  std::same_as
+  < ToTuple<Chunks<4, FromTuple<TTuple<int, bool, char, float, double, short>>>>
+  , TTuple<TTuple<int, bool, char, float>, TTuple<double, short>>
+  >);
+
+static_assert(
+  std::same_as
+  < ToTuple<Chunks<3, FromTuple<TTuple<int, bool, char>>>>
+  , TTuple<TTuple<int, bool, char>>
+  >);
+
+static_assert(type_lists::Empty<Chunks<4, Nil>>);
+
+// TAKE AND DROP
+
+static_assert(std::same_as<ToTuple<Take<10000, Nats>>, Range<0, 10000>>);
+static_assert(std::same_as<ToTuple<Take<3000, Drop<7000, Nats>>>, Range<7000, 3000>>);
+static_assert(Drop<9999, Nats>::Head::Value == 9999);
+static_assert(Drop<12345, Nats>::Head::Value == 12345);
+
+static_assert(std::same_as<ToTuple<Take<5000, Repeat<int>>>, Replicated<5000, int>>);
+static_assert(std::same_as<ToTuple<Replicate<5000, char>>, Replicated<5000, char>>);
+
+static_assert(std::same_as<ToTuple<Drop<5000, Take<5003, Nats>>>, Range<5000, 3>>);
+static_assert(type_lists::Empty<Drop<5003, Take<5003, Nats>>>);
+static_assert(type_lists::Empty<Drop<10000, Take<5003, Nats>>>);
+
+static_assert(std::same_as<Drop<4999, Cycle<FromTuple<TTuple<int, bool>>>>::Head, bool>);
+
+// Long finite lists round trip as well
+static_assert(std::same_as<ToTuple<FromTuple<Range<0, 5000>>>, Range<0, 5000>>);
+
+// TRANSFORMS
+
+static_assert(Drop<4000, Map<Twice, Nats>>::Head::Value == 8000);
+static_assert(Drop<2000, Filter<Odd, Nats>>::Head::Value == 4001);
+static_assert(
+  std::same_as
+  < ToTuple<Take<3, Drop<2000, Filter<Odd, Nats>>>>
+  , VTuple<int, 4001, 4003, 4005>
+  >);
+
+static_assert(Drop<3000, Scanl<Plus, value_types::ValueTag<0>, Nats>>::Head::Value == 2999 * 3000 / 2);
+static_assert(
+  std::same_as
+  < Drop<3000, Zip2<Nats, Repeat<int>>>::Head
+  , TTuple<value_types::ValueTag<3000>, int>
+  >);
+static_assert(std::same_as<ToTuple<Drop<3000, Inits<Nats>>::Head>, Range<0, 3000>>);
+static_assert(Drop<3000, Tails<Nats>>::Head::Head::Value == 3000);
+
+// VALUE SEQUENCES
+
+static_assert(Drop<1000, Primes>::Head::Value == 7927);
+static_assert(Drop<46, Fib>::Head::Value == 1836311903);
+
+// Memoized: the same prefix is reused by every one of those
+static_assert(Drop<1024, Nats>::Head::Value == 1024);
+static_assert(std::same_as<ToTuple<Take<1024, Nats>>, Range<0, 1024>>);
+static_assert(std::same_as<ToTuple<Take<1025, Nats>>, Range<0, 1025>>);
+
+
+int main() {
+  return 0;
+}
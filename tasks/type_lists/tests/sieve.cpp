@@ -0,0 +1,86 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+
+#include <concepts>
+#include <cstddef>
+
+// Primes is still a plain TypeSequence of ValueTags, it just has to be
+// cheap: ten thousand of them must compile in seconds.
+
+
+using type_tuples::TTuple;
+using value_types::VTuple;
+
+using type_lists::ToTuple;
+using type_lists::Take;
+using type_lists::Drop;
+using type_lists::TypeSequence;
+
+
+template<class TT>
+struct Sum;
+
+template<class... Ts>
+struct Sum<TTuple<Ts...>> {
+  static constexpr long long Value = (0LL + ... + Ts::Value);
+};
+
+template<class TT>
+struct Increasing;
+
+template<class... Ts>
+struct Increasing<TTuple<Ts...>> {
+  static constexpr bool Value = [] {
+    constexpr long long values[] = {Ts::Value...};
+    for (std::size_t i = 1; i < sizeof...(Ts); ++i) {
+      if (values[i - 1] >= values[i]) {
+        return false;
+      }
+    }
+    return true;
+  }();
+};
+
+
+static_assert(TypeSequence<Primes>);
+static_assert(TypeSequence<Primes::Tail>);
+static_assert(std::same_as<Primes::Head, value_types::ValueTag<2>>);
+
+static_assert(
+  std::same_as
+  < ToTuple<Take<10, Primes>>
+  , VTuple<int, 2, 3, 5, 7, 11, 13, 17, 19, 23, 29>
+  >);
+
+static_assert(
+  std::same_as
+  < ToTuple<Take<10, Drop<9990, Primes>>>
+  , VTuple
+    < int
+    , 104677
+    , 104681
+    , 104683
+    , 104693
+    , 104701
+    , 104707
+    , 104711
+    , 104717
+    , 104723
+    , 104729
+    >
+  >);
+
+// Window boundaries must not lose or duplicate anything
+static_assert(Drop<999, Primes>::Head::Value == 7919);
+static_assert(Drop<4999, Primes>::Head::Value == 48611);
+static_assert(Drop<10000, Primes>::Head::Value == 104743);
+
+static_assert(Sum<ToTuple<Take<10000, Primes>>>::Value == 496165411);
+static_assert(Increasing<ToTuple<Take<10000, Primes>>>::Value);
+
+
+int main() {
+  return 0;
+}
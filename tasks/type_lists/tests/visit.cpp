@@ -0,0 +1,140 @@
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+#include <lib/visit.hpp>
+#include <testing/assert.hpp>
+
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+// course/lib/visit.hpp on the lists of this task
+
+
+using type_tuples::TTuple;
+using value_types::ValueTag;
+
+using type_lists::Take;
+using type_lists::ToTuple;
+
+using mpc::visit_at;
+
+
+template<class Seq>
+struct TagsImpl;
+
+template<std::size_t... is>
+struct TagsImpl<std::index_sequence<is...>> {
+  using type = TTuple<ValueTag<is>...>;
+};
+
+template<std::size_t n>
+using Tags = typename TagsImpl<std::make_index_sequence<n>>::type;
+
+struct Value {
+  template<class T>
+  constexpr std::size_t operator()() const {
+    return T::Value;
+  }
+};
+
+struct Name {
+  template<class T>
+  std::string operator()() const {
+    if constexpr (std::same_as<T, int>) {
+      return "int";
+    } else if constexpr (std::same_as<T, char>) {
+      return "char";
+    } else {
+      return "other";
+    }
+  }
+};
+
+// Alternatives returning different types cannot share a table
+struct Identity {
+  template<class T>
+  T operator()() const {
+    return T{};
+  }
+};
+
+// Can only be called on an rvalue
+struct Consumed {
+  std::size_t value = 0;
+
+  template<class T>
+  std::size_t operator()() && {
+    return value + T::Value;
+  }
+};
+
+template<class Pack, class F>
+concept Visitable = requires (F&& f) { visit_at<Pack>(0, std::forward<F>(f)); };
+
+static_assert(Visitable<TTuple<int, char>, Name>);
+static_assert(Visitable<TTuple<int, int>, Identity>);
+static_assert(!Visitable<TTuple<int, char>, Identity>);
+static_assert(!Visitable<TTuple<>, Name>);
+static_assert(!Visitable<TTuple<int>, int>);
+static_assert(Visitable<Tags<4>, Consumed>);
+static_assert(!Visitable<Tags<4>, Consumed&>);
+
+static_assert(visit_at<Tags<8>>(5, Value{}) == 5);
+static_assert(visit_at<ToTuple<Take<10, Fib>>>(9, Value{}) == 34);
+
+
+TEST(VisitTest, Dispatch) {
+  using Three = TTuple<int, char, bool>;
+  EXPECT_EQ(visit_at<Three>(0, Name{}), "int");
+  EXPECT_EQ(visit_at<Three>(1, Name{}), "char");
+  EXPECT_EQ(visit_at<Three>(2, Name{}), "other");
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(visit_at<Tags<8>>(i, Value{}), i);
+  }
+
+  using FirstNats = ToTuple<Take<10, Nats>>;
+  for (std::size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(visit_at<FirstNats>(i, Value{}), i);
+  }
+}
+
+TEST(VisitTest, ForwardsVisitor) {
+  std::size_t calls = 0;
+  auto count = [&calls]<class T>() -> std::size_t& {
+    ++calls;
+    return calls;
+  };
+
+  std::size_t& result = visit_at<TTuple<int, char>>(1, count);
+  EXPECT_EQ(&result, &calls);
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_EQ(visit_at<Tags<4>>(3, Consumed{10}), 13);
+}
+
+TEST(VisitTest, BoundsChecked) {
+  EXPECT_RUNTIME_FAIL(({
+    visit_at<TTuple<int, char, bool>>(3, Name{});
+  }));
+
+  EXPECT_RUNTIME_FAIL(({
+    visit_at<Tags<512>>(512, Value{});
+  }));
+
+  EXPECT_RUNTIME_OK(({
+    visit_at<Tags<512>>(511, Value{});
+  }));
+}
+
+TEST(VisitTest, Long) {
+  using Long = Tags<512>;
+  for (std::size_t i = 0; i < 512; ++i) {
+    EXPECT_EQ(visit_at<Long>(i, Value{}), i);
+  }
+}
@@ -0,0 +1,90 @@
+#include <type_tuples.hpp>
+#include <value_types.hpp>
+#include <lib/visit.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+// visit_at against the hand-written if-chain it replaces, for a runtime tag
+// uniformly distributed over 8, 64 and 512 types
+
+template<class Seq>
+struct TagsImpl;
+
+template<std::size_t... is>
+struct TagsImpl<std::index_sequence<is...>> {
+  using type = type_tuples::TTuple<value_types::ValueTag<is>...>;
+};
+
+template<std::size_t n>
+using Tags = typename TagsImpl<std::make_index_sequence<n>>::type;
+
+constexpr std::size_t kQueries = 1 << 12;
+
+// The value of every type goes through DoNotOptimize, so that the compiler
+// cannot fold the chain into arithmetic on the index
+struct Handler {
+  template<class T>
+  std::size_t operator()() const {
+    std::size_t value = T::Value;
+    benchmark::DoNotOptimize(value);
+    return value;
+  }
+};
+
+std::vector<std::size_t> MakeQueries(std::size_t bound) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<std::size_t> distribution(0, bound - 1);
+  std::vector<std::size_t> queries(kQueries);
+  for (std::size_t& query : queries) {
+    query = distribution(generator);
+  }
+  return queries;
+}
+
+// if (index == 0) ... else if (index == 1) ... in the order of the types;
+// optimizers may turn a long enough chain into a jump table of their own
+template<class F, class... Ts>
+std::size_t IfChain(type_tuples::TTuple<Ts...>, std::size_t index, F f) {
+  std::size_t result = 0;
+  std::size_t i = 0;
+  ((index == i++ && (result = f.template operator()<Ts>(), true)) || ...);
+  return result;
+}
+
+template<std::size_t n>
+void BM_VisitAt(benchmark::State& state) {
+  auto queries = MakeQueries(n);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (std::size_t query : queries) {
+      sum += mpc::visit_at<Tags<n>>(query, Handler{});
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+template<std::size_t n>
+void BM_IfChain(benchmark::State& state) {
+  auto queries = MakeQueries(n);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (std::size_t query : queries) {
+      sum += IfChain(Tags<n>{}, query, Handler{});
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+BENCHMARK(BM_VisitAt<8>);
+BENCHMARK(BM_IfChain<8>);
+BENCHMARK(BM_VisitAt<64>);
+BENCHMARK(BM_IfChain<64>);
+BENCHMARK(BM_VisitAt<512>);
+BENCHMARK(BM_IfChain<512>);
@@ -16,3 +16,13 @@ CPMAddPackage(
   VERSION 1.12.1
   OPTIONS "INSTALL_GTEST OFF" "gtest_force_shared_crt"
 )
+
+# google benchmark, only for `make_bench` targets
+if (BENCHMARKS)
+  CPMAddPackage(
+    NAME benchmark
+    GITHUB_REPOSITORY google/benchmark
+    VERSION 1.8.3
+    OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_INSTALL OFF"
+  )
+endif()